@@ -78,7 +78,7 @@ void fio_digitalWrite(fio_register pinRegister, fio_bit pinBit, uint8_t value)
 #ifdef FIO_FALLBACK
 	digitalWrite(pinBit, value);
 #else
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
    {
       if(value == LOW)
       {
@@ -116,7 +116,7 @@ void fio_shiftOut (fio_register dataRegister, fio_bit dataBit,
 	{
 		for(i = 0; i < 8; i++)
 		{
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 			{
 				if(value & 1)
             {
@@ -137,7 +137,7 @@ void fio_shiftOut (fio_register dataRegister, fio_bit dataBit,
 	{
 		for(i = 0; i < 8; i++)
 		{
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 			{
 				if(value & 0x80)
             {
@@ -159,12 +159,16 @@ void fio_shiftOut (fio_register dataRegister, fio_bit dataBit,
 void fio_shiftOut(fio_register dataRegister, fio_bit dataBit, 
                   fio_register clockRegister, fio_bit clockBit)
 {
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   // shift out 0x0 (B00000000) fast, byte order is irrelevant
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
    {
-      // shift out 0x0 (B00000000) fast, byte order is irrelevant
       fio_digitalWrite_LOW (dataRegister, dataBit);
-      
-      for(uint8_t i = 0; i<8; ++i)
+   }
+   
+   // interrupts are masked one clock pulse at a time
+   for(uint8_t i = 0; i<8; ++i)
+   {
+      FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
       {
          fio_digitalWrite_HIGH (clockRegister, clockBit);
          fio_digitalWrite_SWITCH (clockRegister, clockBit);
@@ -213,7 +217,7 @@ void fio_shiftOut1(fio_register shift1Register, fio_bit shift1Bit, uint8_t value
       // initialization
 		if(value & _BV(i))
       {
-         ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
          {
             // HIGH = 1 Bit
             fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,LOW);
@@ -225,7 +229,8 @@ void fio_shiftOut1(fio_register shift1Register, fio_bit shift1Bit, uint8_t value
 		}
       else
       {
-         ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#if (FIO_MASKED_HOLD_US >= 15)
+         FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
          {
             // LOW = 0 Bit
             fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,LOW);
@@ -233,6 +238,20 @@ void fio_shiftOut1(fio_register shift1Register, fio_bit shift1Bit, uint8_t value
             delayMicroseconds(15);
             fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,HIGH);
          } // end critical section
+#else
+         // LOW = 0 Bit, only the edges are atomic. The LOW time is a minimum,
+         // an interrupt in the middle only makes it longer.
+         FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         {
+            fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,LOW);
+         }
+         // hold pin LOW for 15us
+         delayMicroseconds(15);
+         FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         {
+            fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,HIGH);
+         }
+#endif
          
          // hold pin HIGH for 30us
          delayMicroseconds(30);         
@@ -245,14 +264,14 @@ void fio_shiftOut1(fio_register shift1Register, fio_bit shift1Bit, uint8_t value
    
 	if(!noLatch)
    {
-      ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+      FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
       {
          // send last bit (=LOW) and Latch command
          fio_digitalWrite_SWITCHTO(shift1Register,shift1Bit,LOW);
       } // end critical section
       delayMicroseconds(199); 		// Hold pin low for 200us
       
-      ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+      FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
       {
          fio_digitalWrite_HIGH(shift1Register,shift1Bit);
       } // end critical section
@@ -265,3 +284,53 @@ void fio_shiftOut1(uint8_t pin, uint8_t value, boolean noLatch)
 {
 	fio_shiftOut1(fio_pinToOutputRegister(pin, SKIP),fio_pinToBit(pin),value, noLatch);
 }
+
+#ifdef FIO_MASK_PROBE
+// Statistics, only updated with the interrupts masked
+static fio_maskStats_t fio_stats;
+
+void fio_maskProbeEnd ( const uint32_t *start )
+{
+   uint32_t cycles;
+   
+   cycles = ( ( FIO_PROBE_CLOCK() - *start ) & FIO_PROBE_MASK ) * 
+            FIO_PROBE_CYCLES;
+   if ( cycles > fio_stats.maxCycles )
+   {
+      fio_stats.maxCycles = cycles;
+   }
+   fio_stats.totalCycles += cycles;
+   fio_stats.count++;
+}
+#endif
+
+void fio_maskStats ( fio_maskStats_t *stats )
+{
+#ifdef FIO_MASK_PROBE
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      *stats = fio_stats;
+   }
+#else
+   stats->maxCycles   = 0;
+   stats->totalCycles = 0;
+   stats->count       = 0;
+#endif
+}
+
+void fio_maskStatsReset ( void )
+{
+#ifdef FIO_MASK_PROBE
+#if !defined (__AVR__) && ( defined (__ARM_ARCH_7M__) || defined (__ARM_ARCH_7EM__) )
+   // Start the DWT cycle counter (DEMCR.TRCENA, DWT_CTRL.CYCCNTENA)
+   *(volatile uint32_t *)0xE000EDFC |= ( 1UL << 24 );
+   *(volatile uint32_t *)0xE0001000 |= 1UL;
+#endif
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_stats.maxCycles   = 0;
+      fio_stats.totalCycles = 0;
+      fio_stats.count       = 0;
+   }
+#endif
+}
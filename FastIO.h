@@ -85,6 +85,107 @@ static __inline__ void __iSeiParam(const uint8_t *__s)
 
 #endif // end of block to create compatible ATOMIC_BLOCK()
 
+/*!
+ @defined 
+ @abstract   Longest timed hold done with interrupts masked.
+ @discussion The pulses of the shift register protocols (LCD enable, Shift1
+ zero bit) only have a minimum width, an interrupt stretching them is
+ harmless: they are timed with the interrupts enabled and only the pin
+ changes are atomic, keeping the interrupts masked for a few cycles.
+ Holds up to FIO_MASKED_HOLD_US microseconds are timed with the interrupts
+ masked instead, for boards whose interrupt handlers are long enough to
+ stretch a pulse beyond its maximum (a Shift1 zero bit held LOW for ~200us
+ latches the shift register).
+ */
+#ifndef FIO_MASKED_HOLD_US
+#define FIO_MASKED_HOLD_US  0
+#endif
+
+/*!
+ @defined 
+ @abstract   Enables the interrupts masked time probe.
+ @discussion If defined, every critical section of the fast IO and shift
+ register drivers (FIO_ATOMIC_BLOCK) records how long it keeps the interrupts
+ masked, @see fio_maskStats. The probe adds a few cycles to each critical
+ section, leave it undefined in production builds.
+ */
+//#define FIO_MASK_PROBE
+
+/*!
+ @typedef 
+ @abstract   Interrupts masked time statistics.
+ @discussion Times are in CPU cycles, with the resolution of the probe clock
+ (FIO_PROBE_CYCLES).
+ */
+typedef struct
+{
+   uint32_t maxCycles;      // Longest critical section
+   uint32_t totalCycles;    // Time spent in critical sections
+   uint32_t count;          // Number of critical sections
+} fio_maskStats_t;
+
+#ifdef FIO_MASK_PROBE
+
+// Probe clock: the fastest free running counter of the platform
+#if defined (__AVR__)
+// Timer 0 (millis) runs at F_CPU / 64, the critical sections are shorter than
+// a timer 0 period
+#define FIO_PROBE_CLOCK()   ((uint32_t)TCNT0)
+#define FIO_PROBE_MASK      0xFFUL
+#define FIO_PROBE_CYCLES    64
+#elif defined (ESP32) || defined (ESP8266)
+#define FIO_PROBE_CLOCK()   ((uint32_t)ESP.getCycleCount())
+#define FIO_PROBE_MASK      0xFFFFFFFFUL
+#define FIO_PROBE_CYCLES    1
+#elif defined (__ARM_ARCH_7M__) || defined (__ARM_ARCH_7EM__)
+// DWT cycle counter, enabled by fio_maskStatsReset
+#define FIO_PROBE_CLOCK()   (*(volatile uint32_t *)0xE0001004)
+#define FIO_PROBE_MASK      0xFFFFFFFFUL
+#define FIO_PROBE_CYCLES    1
+#else
+#define FIO_PROBE_CLOCK()   ((uint32_t)micros())
+#define FIO_PROBE_MASK      0xFFFFFFFFUL
+#define FIO_PROBE_CYCLES    ( F_CPU / 1000000UL )
+#endif
+
+/*!
+ @function
+ @abstract   Records a critical section.
+ @discussion Used by FIO_ATOMIC_BLOCK, not to be called directly.
+ @param      start[in] probe clock when the interrupts were masked.
+ */
+void fio_maskProbeEnd ( const uint32_t *start );
+
+/*!
+ @defined 
+ @abstract   Critical section with interrupts masked time probe.
+ @discussion ATOMIC_BLOCK recording the time the interrupts are masked.
+ */
+#define FIO_ATOMIC_BLOCK(type) ATOMIC_BLOCK(type) \
+   for ( uint32_t __probeStart __attribute__((__cleanup__(fio_maskProbeEnd))) \
+            = FIO_PROBE_CLOCK(), __probeTodo = 1; \
+         __probeTodo; __probeTodo = 0 )
+
+#else
+#define FIO_ATOMIC_BLOCK(type) ATOMIC_BLOCK(type)
+#endif // FIO_MASK_PROBE
+
+/*!
+ @function
+ @abstract   Interrupts masked time statistics.
+ @discussion Reads the statistics of the critical sections of the fast IO and
+ shift register drivers since the last reset. Without FIO_MASK_PROBE the
+ statistics are all 0.
+ @param      stats[out] statistics.
+ */
+void fio_maskStats ( fio_maskStats_t *stats );
+
+/*!
+ @function
+ @abstract   Resets the interrupts masked time statistics.
+ */
+void fio_maskStatsReset ( void );
+
 /*!
  @defined 
  @abstract   Performs a bitwise shift.
@@ -47,6 +47,7 @@
 #include <inttypes.h>
 
 #include "I2CIO.h"
+#include "I2CScan.h"
 
 
 
@@ -61,7 +62,11 @@ I2CIO::I2CIO ( )
    _i2cAddr     = 0x0;
    _dirMask     = 0xFF;    // mark all as INPUTs
    _shadow      = 0x0;     // no values set
+   _inputs      = 0x0;
    _initialised = false;
+#if defined (TWCR)
+   _twi         = NULL;
+#endif
 }
 
 // PUBLIC METHODS
@@ -74,6 +79,7 @@ int I2CIO::begin (  uint8_t i2cAddr )
 {
    _i2cAddr = i2cAddr;
 
+   flush ( );
    Wire.begin ( );
 
    _initialised = isAvailable ( _i2cAddr );
@@ -86,6 +92,12 @@ int I2CIO::begin (  uint8_t i2cAddr )
       _shadow = Wire.read (); // Remove the byte read don't need it.
 #endif
    }
+#if defined (TWCR)
+   if ( _twi != NULL )
+   {
+      _twi->begin ( _i2cAddr );
+   }
+#endif
    return ( _initialised );
 }
 
@@ -132,12 +144,14 @@ uint8_t I2CIO::read ( void )
 
    if ( _initialised )
    {
+      flush ( );
       Wire.requestFrom ( _i2cAddr, (uint8_t)1 );
 #if (ARDUINO <  100)
-      retVal = ( _dirMask & Wire.receive ( ) );
+      _inputs = Wire.receive ( );
 #else
-      retVal = ( _dirMask & Wire.read ( ) );
+      _inputs = Wire.read ( );
 #endif
+      retVal = ( _dirMask & _inputs );
 
    }
    return ( retVal );
@@ -145,23 +159,66 @@ uint8_t I2CIO::read ( void )
 
 //
 // write
-int I2CIO::write ( uint8_t value )
+int I2CIO::write ( uint8_t value, bool sample )
+{
+   return ( write ( &value, 1, sample ) );
+}
+
+//
+// write (sequence)
+int I2CIO::write ( const uint8_t *values, uint8_t len, bool sample )
 {
    int status = 0;
 
    if ( _initialised )
    {
-      // Only write HIGH the values of the ports that have been initialised as
-      // outputs updating the output shadow of the device
-      _shadow = ( value & ~(_dirMask) );
-
+#if defined (TWCR)
+      if ( ( _twi != NULL ) && !sample )
+      {
+         for ( uint8_t i = 0; i < len; i++ )
+         {
+            _shadow = ( values[i] & ~(_dirMask) );
+            _twi->write ( _shadow | _dirMask );
+         }
+         return ( _twi->status () == TWIIO_OK );
+      }
+#endif
+      flush ( );
+      
+      // PCF8574 IOs are quasi bidirectional, the pins used as inputs have
+      // to be written HIGH (weak pull up) for the device to be able to read
+      // them.
       Wire.beginTransmission ( _i2cAddr );
+      for ( uint8_t i = 0; i < len; i++ )
+      {
+         // Only write HIGH the values of the ports that have been initialised
+         // as outputs updating the output shadow of the device
+         _shadow = ( values[i] & ~(_dirMask) );
 #if (ARDUINO <  100)
-      Wire.send ( _shadow );
+         Wire.send ( _shadow | _dirMask );
 #else
-      Wire.write ( _shadow );
+         Wire.write ( _shadow | _dirMask );
 #endif
+      }
+#if (ARDUINO <  100)
       status = Wire.endTransmission ();
+      
+      if ( sample && ( status == 0 ) )
+      {
+         // No repeated start support, read in a new transaction
+         Wire.requestFrom ( _i2cAddr, (uint8_t)1 );
+         _inputs = Wire.receive ( );
+      }
+#else
+      // Keep the bus with a repeated start to read the inputs
+      status = Wire.endTransmission ( !sample );
+      
+      if ( sample && ( status == 0 ) &&
+           ( Wire.requestFrom ( _i2cAddr, (uint8_t)1 ) == 1 ) )
+      {
+         _inputs = Wire.read ( );
+      }
+#endif
    }
    return ( (status == 0) );
 }
@@ -211,6 +268,40 @@ int I2CIO::digitalWrite ( uint8_t pin, uint8_t level )
    return ( status );
 }
 
+//
+// detect
+uint8_t I2CIO::detect ( uint8_t hint )
+{
+   Wire.begin ( );
+   return ( i2cScan ( hint, isAvailable ) );
+}
+
+#if defined (TWCR)
+//
+// setTransport
+void I2CIO::setTransport ( TWIIO *twi )
+{
+   flush ( );
+   _twi = twi;
+   if ( _twi != NULL )
+   {
+      _twi->begin ( _i2cAddr );
+   }
+}
+#endif
+
+//
+// flush
+void I2CIO::flush ( void )
+{
+#if defined (TWCR)
+   if ( _twi != NULL )
+   {
+      _twi->flush ( );
+   }
+#endif
+}
+
 //
 // PRIVATE METHODS
 // ---------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #define _I2CIO_H_
 
 #include <inttypes.h>
+#include "TWIIO.h"
 
 #define _I2CIO_VERSION "1.0.0"
 
@@ -117,10 +118,40 @@ public:
     using the portMode or pinMode methods. If no pins have been configured as
     OUTPUTs this method will have no effect.
     
+    When "sample" is true the inputs are read in the same bus session, after
+    the write with a repeated start, and kept for readCached. This saves the
+    separate transaction of a read when the device is written often (LCD
+    output).
+    
     @param      value[in] value to be written to the device.
+    @param      sample[in] read the inputs after writing.
     @result     1 on success, 0 otherwise
     */   
-   int write ( uint8_t value );
+   int write ( uint8_t value, bool sample = false );
+   
+   /*!
+    @method
+    @abstract   Last value of the inputs.
+    @discussion Returns the pins configured as INPUT as they were on the last
+    read or sampling write, without accessing the device.
+    
+    @result     last value read of the input pins.
+    */
+   uint8_t readCached ( void ) { return ( _inputs & _dirMask ); };
+   
+   /*!
+    @method
+    @abstract   Writes a sequence of values to the device.
+    @discussion Writes the values in a single I2C transaction, the device
+    updates its outputs after each byte. Saves the addressing of every value
+    when the outputs are toggled (LCD enable pulses). @see write
+    
+    @param      values[in] values to be written to the device.
+    @param      len[in] number of values.
+    @param      sample[in] read the inputs after writing.
+    @result     1 on success, 0 otherwise
+    */
+   int write ( const uint8_t *values, uint8_t len, bool sample = false );
    
    /*!
     @method
@@ -135,13 +166,50 @@ public:
     */   
    int digitalWrite ( uint8_t pin, uint8_t level );
    
+   /*!
+    @method
+    @abstract   Finds the address of an expander.
+    @discussion Probes "hint" first, if it is an expander address, and then
+    the PCF8574 (0x20-0x27) and PCF8574A (0x38-0x3F) addresses, most likely
+    first. Each probe is an address only transaction. @see i2cScan
+    
+    @param      hint[in] address to probe first, 0 for none.
+    @result     address of the first device that answers, 0 if none.
+    */
+   static uint8_t detect ( uint8_t hint );
+   
+#if defined (TWCR)
+   /*!
+    @method
+    @abstract   Sends the writes through a non blocking transport.
+    @discussion The writes are queued in the transport and sent by the TWI
+    hardware while the program continues, write returns at once. A write
+    reports the errors of the earlier transfers. The reads and the writes
+    that sample the inputs wait for the queue to be sent and use Wire.
+    @see TWIIO
+    
+    @param      twi[in] transport, NULL to write with Wire.
+    */
+   void setTransport ( TWIIO *twi );
+#endif
    
+   /*!
+    @method
+    @abstract   Waits for the writes to be sent.
+    @discussion Blocks until the values queued in the transport have been
+    sent, returns at once without a transport. @see setTransport
+    */
+   void flush ( void );
    
 private:
    uint8_t _shadow;      // Shadow output
+   uint8_t _inputs;      // Last value read from the device
    uint8_t _dirMask;     // Direction mask
    uint8_t _i2cAddr;     // I2C address
    bool    _initialised; // Initialised object
+#if defined (TWCR)
+   TWIIO  *_twi;         // Non blocking transport, NULL: Wire
+#endif
 
   /*!
    @method
@@ -151,7 +219,7 @@ private:
    @param      i2cAddr[in] I2C address to check availability 
    @result     true if available, false otherwise.
    */   
-   bool isAvailable (uint8_t i2cAddr);
+   static bool isAvailable (uint8_t i2cAddr);
    
 };
 
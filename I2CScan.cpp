@@ -0,0 +1,70 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file I2CScan.cpp
+// This file implements the address scan of the PCF8574 I2C IO expanders.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+#include "I2CScan.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+// Low address bits of the expanders, one per nibble, ordered by the number of
+// jumpers open: the most likely addresses are scanned first.
+#define SCAN_ORDER  0x76534210UL
+
+// Base addresses of the PCF8574 and the PCF8574A
+#define PCF8574     0x20
+#define PCF8574A    0x38
+
+//
+// i2cScanValid
+bool i2cScanValid ( uint8_t i2cAddr )
+{
+   return ( ( ( i2cAddr & 0xF8 ) == PCF8574 ) ||
+            ( ( i2cAddr & 0xF8 ) == PCF8574A ) );
+}
+
+//
+// i2cScan
+uint8_t i2cScan ( uint8_t hint, t_i2cProbe probe )
+{
+   // A stored hint may be garbage (blank EEPROM), it is only probed if it
+   // can be an expander
+   if ( !i2cScanValid ( hint ) )
+   {
+      hint = 0;
+   }
+   else if ( probe ( hint ) )
+   {
+      return ( hint );
+   }
+
+   // Alternate between PCF8574 and PCF8574A with the same jumper setting
+   for ( uint8_t i = 0; i < 16; i++ )
+   {
+      uint8_t addr = ( ( i & 0x1 ) ? PCF8574A : PCF8574 ) |
+                     ( ( SCAN_ORDER >> ( 28 - ( 4 * ( i >> 1 ) ) ) ) & 0x7 );
+
+      if ( ( addr != hint ) && probe ( addr ) )
+      {
+         return ( addr );
+      }
+   }
+   return ( 0 );
+}
@@ -0,0 +1,61 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file I2CScan.h
+// This file implements the address scan of the PCF8574 I2C IO expanders.
+//
+// @brief
+// The address search shared by the I2C drivers of the expanders (Wire,
+// software I2C). The bus access is left to the caller through a probe
+// function, that checks if a device answers at an address.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _I2C_SCAN_H_
+#define _I2C_SCAN_H_
+
+#include <inttypes.h>
+
+/*!
+ @typedef
+ @abstract   Probe function.
+ @discussion Checks if a device answers at an address of the bus.
+ @param      i2cAddr[in] I2C address probed.
+ @result     true if a device answers, false otherwise.
+ */
+typedef bool (*t_i2cProbe)( uint8_t i2cAddr );
+
+/*!
+ @function
+ @abstract   Checks an expander address.
+ @param      i2cAddr[in] I2C address.
+ @result     true if it is a PCF8574 (0x20-0x27) or PCF8574A (0x38-0x3F)
+ address.
+ */
+bool i2cScanValid ( uint8_t i2cAddr );
+
+/*!
+ @function
+ @abstract   Finds the address of an expander.
+ @discussion Probes "hint" first, if it is an expander address, and then the
+ PCF8574 (0x20-0x27) and PCF8574A (0x38-0x3F) addresses, most likely first:
+ the factory setting with all the address jumpers open (0x27, 0x3F), then
+ the settings with fewer jumpers closed.
+
+ @param      hint[in] address to probe first, 0 for none.
+ @param      probe[in] probe function of the bus.
+ @result     address of the first device that answers, 0 if none.
+ */
+uint8_t i2cScan ( uint8_t hint, t_i2cProbe probe );
+
+#endif
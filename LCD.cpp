@@ -51,7 +51,21 @@
 // Constructor
 LCD::LCD () 
 {
-   
+   _addr       = 0;
+   _cgram      = false;
+   _xferErrors = 0;
+   _clearExec  = HOME_CLEAR_EXEC;
+   _pollCost   = 0;
+   _deferQueue = NULL;
+   _deferHeld  = NULL;
+   _deferSize  = 0;
+   _deferHead  = 0;
+   _deferCount = 0;
+   _readyAt    = 0;
+   _xferCost   = LCD_DEFER_XFER_COST;
+   _blLatency  = 0;
+   _blPending  = false;
+   _blSince    = 0;
 }
 
 // PUBLIC METHODS
@@ -78,74 +92,34 @@ LCD::LCD ()
 //
 void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize) 
 {
-   if (lines > 1) 
-   {
-      _displayfunction |= LCD_2LINE;
-   }
-   _numlines = lines;
-   _cols = cols;
+   // The initialisation has its own timing, it is never deferred
+   uint16_t *deferred = _deferQueue;
    
-   // for some 1 line displays you can select a 10 pixel high font
-   // ------------------------------------------------------------
-   if ((dotsize != LCD_5x8DOTS) && (lines == 1)) 
-   {
-      _displayfunction |= LCD_5x10DOTS;
-   }
+   flush ();
+   _deferQueue = NULL;
+   
+   setGeometry ( cols, lines, dotsize );
    
    // SEE PAGE 45/46 FOR INITIALIZATION SPECIFICATION!
    // according to datasheet, we need at least 40ms after power rises above 2.7V
    // before sending commands. Arduino can turn on way before 4.5V so we'll wait 
-   // 50
+   // 50 since power up. The LCD and the MCU share the supply, millis() tells
+   // how long ago it was, only the remaining time is waited.
    // ---------------------------------------------------------------------------
-   delay (100); // 100ms delay
+   powerUpWait ();
    
    //put the LCD into 4 bit or 8 bit mode
    // -------------------------------------
-   if (! (_displayfunction & LCD_8BITMODE)) 
-   {
-      // this is according to the hitachi HD44780 datasheet
-      // figure 24, pg 46
-      
-      // we start in 8bit mode, try to set 4 bit mode
-      // Special case of "Function Set"
-      send(0x03, FOUR_BITS);
-      delayMicroseconds(4500); // wait min 4.1ms
-      
-      // second try
-      send ( 0x03, FOUR_BITS );
-      delayMicroseconds(150); // wait min 100us
-      
-      // third go!
-      send( 0x03, FOUR_BITS );
-      delayMicroseconds(150); // wait min of 100us
-      
-      // finally, set to 4-bit interface
-      send ( 0x02, FOUR_BITS );
-      delayMicroseconds(150); // wait min of 100us
-
-   } 
-   else 
+   for ( uint8_t step = 0; step < LCD_INIT_STEPS; step++ )
    {
-      // this is according to the hitachi HD44780 datasheet
-      // page 45 figure 23
-      
-      // Send function set command sequence
-      command(LCD_FUNCTIONSET | _displayfunction);
-      delayMicroseconds(4500);  // wait more than 4.1ms
-      
-      // second try
-      command(LCD_FUNCTIONSET | _displayfunction);
-      delayMicroseconds(150);
-      
-      // third go
-      command(LCD_FUNCTIONSET | _displayfunction);
-      delayMicroseconds(150);
-
+      initStep ( step );
+      delayMicroseconds ( initStepTime ( step ) );
    }
    
    // finally, set # lines, font size, etc.
+   // The busy flag can be checked from here on
    command(LCD_FUNCTIONSET | _displayfunction);
-   delayMicroseconds ( 60 );  // wait more
+   waitReady ( 60 );  // wait more
    
    // turn the display on with no cursor or blinking default
    _displaycontrol = LCD_DISPLAYON | LCD_CURSOROFF | LCD_BLINKOFF;  
@@ -160,7 +134,258 @@ void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
    command(LCD_ENTRYMODESET | _displaymode);
 
    backlight();
+   
+   _deferQueue = deferred;
+}
+
+//
+// beginAll
+// Every display is stepped through the same initialisation sequence, the
+// waits of the datasheet are done once per step for all of them. The time
+// spent sending to the other displays counts as part of their wait.
+void LCD::beginAll(LCD *lcd[], uint8_t numLcds, uint8_t cols, uint8_t lines,
+                   uint8_t dotsize)
+{
+   uint8_t  i;
+   uint16_t clearExec = 0;
+   
+   for ( i = 0; i < numLcds; i++ )
+   {
+      // The initialisation has its own timing, it is never deferred
+      lcd[i]->flush ();
+      lcd[i]->_deferHeld  = lcd[i]->_deferQueue;
+      lcd[i]->_deferQueue = NULL;
+      
+      lcd[i]->setGeometry ( cols, lines, dotsize );
+      lcd[i]->startInterface ();
+   }
+   
+   powerUpWait ();
+   
+   for ( uint8_t step = 0; step < LCD_INIT_STEPS; step++ )
+   {
+      for ( i = 0; i < numLcds; i++ )
+      {
+         lcd[i]->initStep ( step );
+      }
+      delayMicroseconds ( initStepTime ( step ) );
+   }
+   
+   for ( i = 0; i < numLcds; i++ )
+   {
+      lcd[i]->command(LCD_FUNCTIONSET | lcd[i]->_displayfunction);
+   }
+   delayMicroseconds ( 60 );
+   
+   for ( i = 0; i < numLcds; i++ )
+   {
+      lcd[i]->_displaycontrol = LCD_DISPLAYON | LCD_CURSOROFF | LCD_BLINKOFF;  
+      lcd[i]->display();
+      lcd[i]->command(LCD_CLEARDISPLAY);
+      lcd[i]->_addr  = 0;
+      lcd[i]->_cgram = false;
+      if ( lcd[i]->_clearExec > clearExec )
+      {
+         clearExec = lcd[i]->_clearExec;
+      }
+   }
+   delayMicroseconds ( clearExec );
+   
+   for ( i = 0; i < numLcds; i++ )
+   {
+      lcd[i]->_displaymode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
+      lcd[i]->command(LCD_ENTRYMODESET | lcd[i]->_displaymode);
+      lcd[i]->backlight();
+      
+      lcd[i]->_deferQueue = lcd[i]->_deferHeld;
+      lcd[i]->_deferHeld  = NULL;
+   }
+}
+
+//
+// beginWarm
+// The LCD has kept its configuration and contents, only the interface may
+// be out of sync if the MCU was reset in the middle of a transfer.
+void LCD::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize) 
+{
+   // The initialisation has its own timing, it is never deferred
+   uint16_t *deferred = _deferQueue;
+   
+   flush ();
+   _deferQueue = NULL;
+   
+   setGeometry ( cols, lines, dotsize );
+   
+   syncInterface ();
+   
+   command(LCD_FUNCTIONSET | _displayfunction);
+   
+   _displaycontrol = LCD_DISPLAYON | LCD_CURSOROFF | LCD_BLINKOFF;  
+   display();
+   
+   _displaymode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
+   command(LCD_ENTRYMODESET | _displaymode);
+   
+   // Position the cursor without the time consuming home command
+   _addr  = 0;
+   _cgram = false;
+   command(LCD_SETDDRAMADDR | _addr);
+   
+   backlight();
+   
+   _deferQueue = deferred;
+}
+
+//
+// resync
+void LCD::resync()
+{
+   // The resync sequence has its own timing, it is never deferred
+   uint16_t *deferred = _deferQueue;
+   
+   flush ();
+   _deferQueue = NULL;
+   
+   syncInterface ();
+   restoreConfig ();
+   
+   // The resync sequence may have executed a return home
+   _cgram = false;
+   command(LCD_SETDDRAMADDR | _addr);
+   
+   _xferErrors = 0;
+   _deferQueue = deferred;
+}
+
+//
+// restoreConfig
+void LCD::restoreConfig()
+{
+   command(LCD_FUNCTIONSET | _displayfunction);
+   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   command(LCD_ENTRYMODESET | _displaymode);
+}
+
+//
+// checkSync
+bool LCD::checkSync()
+{
+   bool inSync;
+   int  status;
+   
+   flush ();
+   inSync = ( _xferErrors == 0 );
+   
+   if ( inSync && !_cgram )
+   {
+      status = recv ( COMMAND );
+      if ( ( status >= 0 ) && ( status & LCD_BUSY_FLAG ) )
+      {
+         waitReady ( _clearExec );
+         status = recv ( COMMAND );
+      }
+      // Reading out of phase gives a mix of nibbles that doesn't match the
+      // address counter
+      if ( ( status >= 0 ) && ( ( status & ~LCD_BUSY_FLAG ) != _addr ) )
+      {
+         inSync = false;
+      }
+   }
+   
+   if ( !inSync )
+   {
+      resync ();
+   }
+   return ( inSync );
+}
 
+//
+// setDeferred
+void LCD::setDeferred(uint16_t *queue, uint8_t size)
+{
+   flush ();
+   _deferQueue = ( size > 0 ) ? queue : NULL;
+   _deferSize  = size;
+   _deferHead  = 0;
+}
+
+//
+// service
+uint8_t LCD::service(uint16_t budget)
+{
+   unsigned long start = micros ();
+   unsigned long t;
+   
+   while ( _deferCount > 0 )
+   {
+      uint16_t entry = _deferQueue[_deferHead];
+      
+      if ( ( entry >> 8 ) != LCD_DEFER_WAIT )
+      {
+         // Let the LCD complete a time consuming command (clear, home)
+         t = _readyAt - micros ();
+         if ( (long)t > 0 )
+         {
+            if ( micros () - start + t > budget )
+            {
+               break;
+            }
+            delayMicroseconds ( t );
+         }
+         
+         if ( micros () - start + _xferCost > budget )
+         {
+            // Let a cost estimate inflated by a slow transfer decay, otherwise
+            // a budget below it would stop the output for good
+            _xferCost -= ( _xferCost + 7 ) / 8;
+            break;
+         }
+      }
+      
+      t = micros ();
+      runDeferred ();
+      t = micros () - t;
+      
+      // Track the cost of a transfer to plan the next ones
+      if ( ( entry >> 8 ) != LCD_DEFER_WAIT )
+      {
+         _xferCost = ( ( 3UL * _xferCost ) + t ) / 4;
+      }
+   }
+   
+   // Nothing has carried the backlight change within its latency
+   if ( _blPending && ( _deferCount == 0 ) && 
+        ( millis () - _blSince >= _blLatency ) )
+   {
+      _blPending = false;
+      writeBacklight ();
+   }
+   return ( _deferCount );
+}
+
+//
+// setBacklightLatency
+void LCD::setBacklightLatency(uint16_t latency)
+{
+   _blLatency = latency;
+   
+   if ( ( latency == 0 ) && _blPending )
+   {
+      _blPending = false;
+      writeBacklight ();
+   }
+}
+
+//
+// flush
+void LCD::flush()
+{
+   while ( _deferCount > 0 )
+   {
+      // Let the LCD complete a time consuming command (clear, home)
+      while ( (long)( _readyAt - micros () ) > 0 );
+      runDeferred ();
+   }
 }
 
 // Common LCD Commands
@@ -168,13 +393,17 @@ void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
 void LCD::clear()
 {
    command(LCD_CLEARDISPLAY);             // clear display, set cursor position to zero
-   delayMicroseconds(HOME_CLEAR_EXEC);    // this command is time consuming
+   waitReady(_clearExec);                 // this command is time consuming
+   _addr  = 0;
+   _cgram = false;
 }
 
 void LCD::home()
 {
    command(LCD_RETURNHOME);             // set cursor position to zero
-   delayMicroseconds(HOME_CLEAR_EXEC);  // This command is time consuming
+   waitReady(_clearExec);               // This command is time consuming
+   _addr  = 0;
+   _cgram = false;
 }
 
 void LCD::setCursor(uint8_t col, uint8_t row)
@@ -191,13 +420,39 @@ void LCD::setCursor(uint8_t col, uint8_t row)
    // ----------------------------------------
    if ( _cols == 16 && _numlines == 4 )
    {
-      command(LCD_SETDDRAMADDR | (col + row_offsetsLarge[row]));
+      _addr = col + row_offsetsLarge[row];
    }
    else 
    {
-      command(LCD_SETDDRAMADDR | (col + row_offsetsDef[row]));
+      _addr = col + row_offsetsDef[row];
    }
+   _cgram = false;
+   command(LCD_SETDDRAMADDR | _addr);
+}
+
+// Read back the contents of the DDRAM
+uint8_t LCD::readScreen(uint8_t col, uint8_t row, uint8_t *buf, uint8_t len)
+{
+   uint8_t i;
+   int     value;
+   
+   flush ();
    
+   // Setting the address is needed before reading, the LCD doesn't
+   // prefetch the data after a write.
+   setCursor ( col, row );
+   
+   for ( i = 0; i < len; i++ )
+   {
+      value = recv ( LCD_DATA );
+      if ( value < 0 )
+      {
+         break;
+      }
+      buf[i] = (uint8_t)value;
+      stepAddr ( _displaymode & LCD_ENTRYLEFT );
+   }
+   return ( i );
 }
 
 // Turn the display on/off
@@ -267,12 +522,14 @@ void LCD::rightToLeft(void)
 void LCD::moveCursorRight(void)
 {
    command(LCD_CURSORSHIFT | LCD_CURSORMOVE | LCD_MOVERIGHT);
+   stepAddr ( true );
 }
 
 // This method moves the cursor one space to the left
 void LCD::moveCursorLeft(void)
 {
    command(LCD_CURSORSHIFT | LCD_CURSORMOVE | LCD_MOVELEFT);
+   stepAddr ( false );
 }
 
 
@@ -298,6 +555,8 @@ void LCD::createChar(uint8_t location, uint8_t charmap[])
    command(LCD_SETCGRAMADDR | (location << 3));
    delayMicroseconds(30);
    
+   _cgram = true;
+   
    for (uint8_t i = 0; i < 8; i++)
    {
       write(charmap[i]);      // call the virtual write method
@@ -305,13 +564,13 @@ void LCD::createChar(uint8_t location, uint8_t charmap[])
    }
 }
 
-#ifdef __AVR__
 void LCD::createChar(uint8_t location, const char *charmap)
 {
    location &= 0x7;   // we only have 8 memory locations 0-7
    
    command(LCD_SETCGRAMADDR | (location << 3));
    delayMicroseconds(30);
+   _cgram = true;
    
    for (uint8_t i = 0; i < 8; i++)
    {
@@ -319,7 +578,67 @@ void LCD::createChar(uint8_t location, const char *charmap)
       delayMicroseconds(40);
    }
 }
-#endif // __AVR__
+
+// Stream rows into the CGRAM and return to the DDRAM cursor position
+void LCD::writeCGRAM(uint8_t location, uint8_t row, const uint8_t *data, 
+                     uint8_t len)
+{
+   command(LCD_SETCGRAMADDR | ((location & 0x7) << 3) | (row & 0x7));
+   
+   transferBulk(data, len);
+   
+   // Leave the LCD pointing to the DDRAM, where the application left it
+   // ------------------------------------------------------------------
+   _cgram = false;
+   command(LCD_SETDDRAMADDR | _addr);
+}
+
+// Stream packed glyphs into the CGRAM
+void LCD::loadGlyph(uint8_t location, const uint8_t *glyphs, uint16_t index)
+{
+   loadGlyphs(location, glyphs, &index, 1);
+}
+
+void LCD::loadGlyphs(uint8_t location, const uint8_t *glyphs,
+                     const uint16_t *indices, uint8_t count)
+{
+   uint8_t rows[8];
+   
+   command(LCD_SETCGRAMADDR | ((location & 0x7) << 3));
+   
+   while ( count-- > 0 )
+   {
+      unpackGlyph(glyphs, *indices++, rows);
+      transferBulk(rows, 8);
+   }
+   
+   // Leave the LCD pointing to the DDRAM, where the application left it
+   // ------------------------------------------------------------------
+   _cgram = false;
+   command(LCD_SETDDRAMADDR | _addr);
+}
+
+// Expand a packed glyph, 5 bits per row MSB first
+void LCD::unpackGlyph(const uint8_t *glyphs, uint16_t index, uint8_t rows[])
+{
+   uint8_t packed[LCD_GLYPH_SIZE + 1];
+   
+   glyphs += index * LCD_GLYPH_SIZE;
+   for (uint8_t i = 0; i < LCD_GLYPH_SIZE; i++)
+   {
+      packed[i] = pgm_read_byte_near(glyphs++);
+   }
+   packed[LCD_GLYPH_SIZE] = 0;
+   
+   // Each row is within a 16 bit window starting at its byte
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      uint8_t  bit    = i * 5;
+      uint16_t window = ((uint16_t)packed[bit >> 3] << 8) | packed[(bit >> 3) + 1];
+      
+      rows[i] = (window >> (11 - (bit & 0x7))) & 0x1f;
+   }
+}
 
 //
 // Switch on the backlight
@@ -355,18 +674,312 @@ void LCD::off ( void )
 // ---------------------------------------------------------------------------
 void LCD::command(uint8_t value) 
 {
-   send(value, COMMAND);
+   transfer(value, COMMAND);
 }
 
 #if (ARDUINO <  100)
 void LCD::write(uint8_t value)
 {
-   send(value, LCD_DATA);
+   transfer(value, LCD_DATA);
+   if ( !_cgram )
+   {
+      stepAddr ( _displaymode & LCD_ENTRYLEFT );
+   }
 }
 #else
 size_t LCD::write(uint8_t value) 
 {
-   send(value, LCD_DATA);
+   transfer(value, LCD_DATA);
+   if ( !_cgram )
+   {
+      stepAddr ( _displaymode & LCD_ENTRYLEFT );
+   }
    return 1;             // assume OK
 }
 #endif
+
+// Characters are sent in chunks up to the length a transfer can carry
+#if (ARDUINO <  100)
+void LCD::write(const uint8_t *buffer, size_t size)
+#else
+size_t LCD::write(const uint8_t *buffer, size_t size)
+#endif
+{
+#if (ARDUINO >=  100)
+   size_t written = size;
+#endif
+   
+   while ( size > 0 )
+   {
+      uint8_t len = ( size > 0xFF ) ? 0xFF : size;
+      
+      transferBulk(buffer, len);
+      if ( !_cgram )
+      {
+         for ( uint8_t i = 0; i < len; i++ )
+         {
+            stepAddr ( _displaymode & LCD_ENTRYLEFT );
+         }
+      }
+      buffer += len;
+      size   -= len;
+   }
+#if (ARDUINO >=  100)
+   return ( written );   // assume OK
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setGeometry
+void LCD::setGeometry(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   if (lines > 1) 
+   {
+      _displayfunction |= LCD_2LINE;
+   }
+   _numlines = lines;
+   _cols = cols;
+   
+   // for some 1 line displays you can select a 10 pixel high font
+   // ------------------------------------------------------------
+   if ((dotsize != LCD_5x8DOTS) && (lines == 1)) 
+   {
+      _displayfunction |= LCD_5x10DOTS;
+   }
+}
+
+//
+// initStep
+void LCD::initStep(uint8_t step)
+{
+   if (! (_displayfunction & LCD_8BITMODE)) 
+   {
+      // this is according to the hitachi HD44780 datasheet
+      // figure 24, pg 46
+      
+      // we start in 8bit mode, try to set 4 bit mode three times (special
+      // case of "Function Set"), finally, set to 4-bit interface
+      send ( ( step < 3 ) ? 0x03 : 0x02, FOUR_BITS );
+   } 
+   else if ( step < 3 )
+   {
+      // this is according to the hitachi HD44780 datasheet
+      // page 45 figure 23
+      
+      // Send function set command sequence three times
+      command(LCD_FUNCTIONSET | _displayfunction);
+   }
+}
+
+//
+// initStepTime
+uint16_t LCD::initStepTime(uint8_t step)
+{
+   // wait min 4.1ms after the first try, min 100us after the others
+   return ( ( step == 0 ) ? 4500 : 150 );
+}
+
+//
+// syncInterface
+// In 4 bit mode the LCD may be waiting for the second nibble of a byte. The
+// first 0x3 nibble then completes an instruction of the form 0xX3, the worst
+// case being a return home, it can never be a clear. After it, two 0x3
+// nibbles form a function set to 8 bits whatever the phase was, and 0x2
+// switches to 4 bits in phase.
+void LCD::syncInterface()
+{
+   if (! (_displayfunction & LCD_8BITMODE)) 
+   {
+      send ( 0x03, FOUR_BITS );
+      delayMicroseconds(_clearExec);      // completed command may be a home
+      
+      send ( 0x03, FOUR_BITS );
+      delayMicroseconds(150);
+      
+      send ( 0x03, FOUR_BITS );
+      delayMicroseconds(150);
+      
+      send ( 0x02, FOUR_BITS );
+      delayMicroseconds(150);
+   }
+   else 
+   {
+      command(LCD_FUNCTIONSET | _displayfunction);
+      delayMicroseconds(150);
+   }
+}
+
+//
+// transfer
+void LCD::transfer(uint8_t value, uint8_t mode)
+{
+   if ( _deferQueue == NULL )
+   {
+      send ( value, mode );
+      _blPending = false;      // The transfer carries the backlight state
+      return;
+   }
+   
+   if ( _deferCount == _deferSize )
+   {
+      // Queue full, make room executing the oldest transfer now
+      while ( (long)( _readyAt - micros () ) > 0 );
+      runDeferred ();
+   }
+   _deferQueue[( _deferHead + _deferCount ) % _deferSize] = 
+      ( (uint16_t)mode << 8 ) | value;
+   _deferCount++;
+}
+
+//
+// transferBulk
+void LCD::transferBulk(const uint8_t *data, uint8_t len)
+{
+   if ( _deferQueue != NULL )
+   {
+      while ( len-- > 0 )
+      {
+         transfer(*data++, LCD_DATA);
+      }
+      return;
+   }
+   
+   if ( len > 0 )
+   {
+      sendBulk ( data, len );
+      _blPending = false;      // The transfer carries the backlight state
+   }
+}
+
+//
+// sendBulk
+void LCD::sendBulk(const uint8_t *data, uint8_t len)
+{
+   while ( len-- > 0 )
+   {
+      send ( *data++, LCD_DATA );
+   }
+}
+
+//
+// runDeferred
+void LCD::runDeferred()
+{
+   uint16_t entry = _deferQueue[_deferHead];
+   uint8_t  mode  = entry >> 8;
+   
+   if ( mode == LCD_DEFER_WAIT )
+   {
+      _readyAt = micros () + ( (unsigned long)( entry & 0xFF ) * 
+                               LCD_DEFER_WAIT_UNIT );
+   }
+   else
+   {
+      send ( entry & 0xFF, mode );
+      _blPending = false;
+   }
+   _deferHead = ( _deferHead + 1 ) % _deferSize;
+   _deferCount--;
+}
+
+//
+// deferBacklight
+bool LCD::deferBacklight()
+{
+   if ( _blLatency == 0 )
+   {
+      return ( false );
+   }
+   
+   // Keep the time of the first change not yet written
+   if ( !_blPending )
+   {
+      _blPending = true;
+      _blSince   = millis ();
+   }
+   return ( true );
+}
+
+//
+// powerUpWait
+void LCD::powerUpWait()
+{
+   unsigned long upTime = millis ();
+   
+   if ( upTime < LCD_POWERUP_MS )
+   {
+      delay ( LCD_POWERUP_MS - upTime );
+   }
+}
+
+//
+// waitReady
+// Reading the busy flag over a transport that is slower than the LCD costs
+// more than the fixed wait, a poll is only worth it if one read is shorter
+// than the wait. It also needs the RW line: when it is tied to GND the enable
+// pulses of the reads write the data lines to the LCD as instructions. The
+// drivers set _pollCost only if they can read the LCD.
+void LCD::waitReady(uint16_t maxUs)
+{
+   unsigned long start = micros ();
+   int status;
+   
+   if ( _deferQueue != NULL )
+   {
+      // The wait is done by service before the next transfer
+      transfer ( ( maxUs + LCD_DEFER_WAIT_UNIT - 1 ) / LCD_DEFER_WAIT_UNIT,
+                 LCD_DEFER_WAIT );
+      return;
+   }
+   
+   if ( ( _pollCost == 0 ) || ( _pollCost >= maxUs ) )
+   {
+      delayMicroseconds ( maxUs );
+      return;
+   }
+   
+   do
+   {
+      status = recv ( COMMAND );
+      if ( status < 0 )
+      {
+         // Reading not supported by the driver, use the worst case time
+         delayMicroseconds ( maxUs );
+         return;
+      }
+   } while ( ( status & LCD_BUSY_FLAG ) && ( micros () - start < maxUs ) );
+}
+
+//
+// stepAddr
+// The DDRAM of a 2 line LCD is split in two banks of 40 positions (0x00..0x27
+// and 0x40..0x67), the address counter jumps from the end of one bank to the
+// beginning of the other. 1 line LCDs have a single bank of 80 positions.
+void LCD::stepAddr(bool forward)
+{
+   if ( _displayfunction & LCD_2LINE )
+   {
+      if ( forward )
+      {
+         _addr = ( _addr == 0x27 ) ? 0x40 : ( _addr == 0x67 ) ? 0x00 : _addr + 1;
+      }
+      else
+      {
+         _addr = ( _addr == 0x40 ) ? 0x27 : ( _addr == 0x00 ) ? 0x67 : _addr - 1;
+      }
+   }
+   else
+   {
+      if ( forward )
+      {
+         _addr = ( _addr >= 0x4F ) ? 0x00 : _addr + 1;
+      }
+      else
+      {
+         _addr = ( _addr == 0x00 ) ? 0x4F : _addr - 1;
+      }
+   }
+}
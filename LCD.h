@@ -50,6 +50,21 @@
 #include <inttypes.h>
 #include <Print.h>
 
+/*!
+ @defined 
+ @abstract   Program memory access for non AVR targets.
+ @discussion Cores that do not provide PROGMEM or the pgm_read_byte family
+ keep constant tables in the same address space as RAM, they are read
+ directly.
+ */
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#ifndef pgm_read_byte_near
+#define pgm_read_byte_near(addr) (*(const uint8_t *)(addr))
+#endif
+
 
 /*!
  @defined 
@@ -156,10 +171,91 @@ inline static void waitUsec ( uint16_t uSec )
  @defined 
  @abstract   Defines the duration of the home and clear commands
  @discussion This constant defines the time it takes for the home and clear
- commands in the LCD - Time in microseconds.
+ commands in the LCD - Time in microseconds. Drivers of faster controllers
+ set their own time, @see _clearExec.
  */
 #define HOME_CLEAR_EXEC      2000
 
+/*!
+ @defined 
+ @abstract   LCD power up time.
+ @discussion Time in milliseconds since the power up of the board before the
+ LCD accepts commands. The HD44780 needs 40ms after VCC rises above 2.7V and
+ the MCU can start running well before the supply reaches 4.5V. begin only
+ waits the part of this time that hasn't already elapsed.
+ */
+#ifndef LCD_POWERUP_MS
+#define LCD_POWERUP_MS         50
+#endif
+
+/*!
+ @defined 
+ @abstract   LCD busy flag.
+ @discussion Bit of the value read in COMMAND mode (busy flag and address
+ counter) set while the LCD is executing an instruction.
+ */
+#define LCD_BUSY_FLAG        0x80
+
+/*!
+ @defined 
+ @abstract   Number of steps of the interface initialisation sequence.
+ @discussion Function set commands sent before the interface width is
+ known by the LCD, @see LCD::beginAll.
+ */
+#define LCD_INIT_STEPS         4
+
+/*!
+ @defined 
+ @abstract   Initial estimate of the time of a transfer to the LCD.
+ @discussion Time in microseconds used by service to plan the first transfers
+ before it has measured the real cost of the driver in use.
+ */
+#define LCD_DEFER_XFER_COST    500
+
+/*!
+ @defined 
+ @abstract   Resolution of the waits queued in deferred mode.
+ @discussion Execution waits (clear, home) are queued in units of this many
+ microseconds.
+ */
+#define LCD_DEFER_WAIT_UNIT    32
+
+// Deferred mode queue entry for an execution wait (used by the send queue)
+#define LCD_DEFER_WAIT         3
+
+/*!
+ @defined 
+ @abstract   Size of a packed glyph.
+ @discussion A packed glyph stores the 5 significant bits of each of its 8
+ rows back to back, 40 bits, instead of the 8 bytes taken by createChar.
+ */
+#define LCD_GLYPH_SIZE         5
+
+/*!
+ @defined 
+ @abstract   Packs a glyph.
+ @discussion Expands to the LCD_GLYPH_SIZE bytes of a packed glyph, to be used
+ in the initialiser of a glyph set in program memory. The rows are given in
+ the same format as createChar, top row first:
+    const uint8_t icons[] PROGMEM = {
+       LCD_GLYPH(0x04, 0x0e, 0x0e, 0x0e, 0x1f, 0x00, 0x04, 0x00), // bell
+       LCD_GLYPH(0x02, 0x03, 0x02, 0x0e, 0x1e, 0x0c, 0x00, 0x00), // note
+    };
+ The glyphs are loaded in the CGRAM with loadGlyph or loadGlyphs.
+ */
+#define LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) \
+   ( ( (uint64_t)( (r0) & 0x1f ) << 35 ) | ( (uint64_t)( (r1) & 0x1f ) << 30 ) | \
+     ( (uint64_t)( (r2) & 0x1f ) << 25 ) | ( (uint64_t)( (r3) & 0x1f ) << 20 ) | \
+     ( (uint64_t)( (r4) & 0x1f ) << 15 ) | ( (uint64_t)( (r5) & 0x1f ) << 10 ) | \
+     ( (uint64_t)( (r6) & 0x1f ) << 5 )  | ( (uint64_t)( (r7) & 0x1f ) ) )
+
+#define LCD_GLYPH(r0,r1,r2,r3,r4,r5,r6,r7) \
+   (uint8_t)( LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) >> 32 ), \
+   (uint8_t)( LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) >> 24 ), \
+   (uint8_t)( LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) >> 16 ), \
+   (uint8_t)( LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) >> 8 ),  \
+   (uint8_t)( LCD_GLYPH_BITS(r0,r1,r2,r3,r4,r5,r6,r7) )
+
 /*!
     @defined 
     @abstract   Backlight off constant declaration
@@ -177,6 +273,32 @@ inline static void waitUsec ( uint16_t uSec )
 #define BACKLIGHT_ON          255
 
 
+/*!
+ @defined 
+ @abstract   Automatic I2C address.
+ @discussion Used as the address of the I2C drivers to detect the address of
+ the backpack on initialisation. The last address found can be kept across
+ boots with setAddressStore.
+ */
+#define I2C_ADDR_AUTO        0x00
+
+/*!
+ @typedef 
+ @abstract   Loads the last known I2C address.
+ @discussion Application function returning the address stored by the
+ t_i2cAddrSave function, or I2C_ADDR_AUTO if there is none.
+ */
+typedef uint8_t (*t_i2cAddrLoad)( void );
+
+/*!
+ @typedef 
+ @abstract   Stores the I2C address detected.
+ @discussion Application function keeping the address in non volatile
+ storage (EEPROM, flash, RTC memory, ...). Only called when the address
+ changes.
+ */
+typedef void (*t_i2cAddrSave)( uint8_t addr );
+
 /*!
  @typedef 
  @abstract   Define backlight control polarity
@@ -213,6 +335,164 @@ public:
     */
    virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
    
+   /*!
+    @function
+    @abstract   LCD warm initialization.
+    @discussion Attaches to an LCD that has stayed powered and configured
+    while the microcontroller was reset (watchdog, brown-out of the MCU only,
+    software reset, ...). Unlike begin, there is no power up wait and the
+    contents of the display are not cleared: the 4 bit interface is
+    resynchronised and the function set, display control and entry mode are
+    written with the same defaults as begin. The cursor is left in the
+    upper-left corner.
+    
+    It MUST only be used when the LCD is known to have been initialised
+    before, on a cold start use begin.
+    
+    On drivers that can read from the LCD, the contents of the display can
+    be read back with readScreen, @see readScreen.
+    
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] character size, default==LCD_5x8DOTS
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows, 
+                          uint8_t charsize = LCD_5x8DOTS);
+   
+   /*!
+    @function
+    @abstract   Initialization of several LCDs.
+    @discussion Initializes a set of LCDs of the same size concurrently, it
+    is equivalent to calling begin on each of them. The LCDs are stepped
+    through the initialisation sequence together so that the power up and
+    command execution waits are done once for all of them: the time needed
+    is that of initialising a single LCD plus the time to send the commands
+    to the rest. The LCDs can use any mix of drivers.
+    
+    @param      lcd[in] array of the LCDs to initialise.
+    @param      numLcds[in] number of LCDs in the array.
+    @param      cols[in] the number of columns that the displays have
+    @param      rows[in] the number of rows that the displays have
+    @param      charsize[in] character size, default==LCD_5x8DOTS
+    */
+   static void beginAll(LCD *lcd[], uint8_t numLcds, uint8_t cols, 
+                        uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+   
+   /*!
+    @function
+    @abstract   Resynchronises the LCD.
+    @discussion Recovers an LCD whose 4 bit interface has lost the nibble
+    phase (a lost enable pulse, a failed I2C transfer, noise on the lines):
+    sends the interface initialisation sequence without the power up wait and
+    restores the function set, display control, entry mode and cursor
+    position from the values held by the library. The display is not
+    cleared, but characters or commands received while out of sync may have
+    altered it, the application should redraw it (@see LCDPages::redraw).
+    */
+   void resync();
+   
+   /*!
+    @function
+    @abstract   Rewrites the LCD configuration.
+    @discussion Writes again the function set, display control and entry mode
+    registers of the LCD from the values held by the library, undoing any
+    change caused by electrical noise or ESD. The contents of the display and
+    the cursor position are not changed.
+    */
+   void restoreConfig();
+   
+   /*!
+    @function
+    @abstract   Checks that the LCD interface is in sync.
+    @discussion Detects a desynchronised interface and resynchronises it
+    (@see resync). The interface is considered out of sync if the driver has
+    reported transfer errors since the last resync or, on drivers that can
+    read from the LCD, if the address counter of the LCD doesn't match the
+    cursor position held by the library. Drivers that can't read from the LCD
+    nor detect transfer errors always report the interface in sync.
+    
+    Intended to be called periodically from the main loop.
+    
+    @result     true if the interface was in sync, false if it has been
+    resynchronised and the contents of the display should be redrawn.
+    */
+   bool checkSync();
+   
+   /*!
+    @function
+    @abstract   Transfer errors.
+    @result     number of transfer errors reported by the driver since the
+    last resync (saturates at 255).
+    */
+   uint8_t transferErrors() { return ( _xferErrors ); };
+   
+   /*!
+    @function
+    @abstract   Enables the deferred (cooperative) mode.
+    @discussion In deferred mode the LCD methods (print, setCursor, clear, ...)
+    don't access the bus: the transfers are queued and executed by service,
+    within the time budget given by the application. This keeps a slow
+    transport (I2C) from stretching the period of a control loop.
+    
+    The queue holds one entry per byte sent to the LCD. If a method is called
+    with the queue full, the oldest transfer is executed immediately, the
+    queue has to be sized for the output produced between calls to service.
+    
+    begin, beginWarm and resync are always executed immediately. Methods that
+    read from the LCD execute the queued transfers first.
+    
+    @param      queue[in] queue storage, NULL to return to immediate mode.
+    @param      size[in] number of entries of the queue.
+    */
+   void setDeferred(uint16_t *queue, uint8_t size);
+   
+   /*!
+    @function
+    @abstract   Executes queued transfers within a time budget.
+    @discussion Executes transfers from the deferred mode queue until it is
+    empty or the next transfer wouldn't fit in the budget, the rest are left
+    for the next call. Transfers are whole bytes: a 4 bit interface is never
+    left between the two nibbles of a byte. The time the LCD needs to execute
+    a clear or home is waited only if it fits in the budget, otherwise the
+    call returns.
+    
+    The duration of a transfer is measured on every call and used to plan
+    the next ones. A call can exceed the budget by the amount a transfer
+    takes longer than the measured average, bounded by the duration of one
+    transfer: about 0.8ms for a PCF8574 backpack at 100kHz (4 bus writes
+    per byte), 0.2ms at 400kHz and under 0.1ms for the parallel and shift
+    register drivers.
+    
+    A backlight change that has waited its latency without being carried
+    by a transfer is written here, @see setBacklightLatency.
+    
+    @param      budget[in] maximum time in microseconds to spend in the call.
+    @result     number of transfers still queued.
+    */
+   uint8_t service(uint16_t budget);
+   
+   /*!
+    @function
+    @abstract   Delays backlight changes to the next transfer.
+    @discussion The drivers whose backlight is a line of the LCD interface
+    (I2C, shift registers) have to write the interface to change it. With a
+    latency the new backlight state is only recorded and goes out with the
+    next command or character sent to the LCD, saving the transfer. If nothing
+    is sent within the latency the change is written by service, which has to
+    be called periodically.
+    
+    @param      latency[in] maximum delay of a backlight change in
+    milliseconds, 0 to write the changes immediately (default).
+    */
+   void setBacklightLatency(uint16_t latency);
+   
+   /*!
+    @function
+    @abstract   Executes all the queued transfers.
+    @discussion Blocks until the deferred mode queue is empty.
+    */
+   virtual void flush();
+   
    /*!
     @function
     @abstract   Clears the LCD.
@@ -399,11 +679,10 @@ public:
     */
    void createChar(uint8_t location, uint8_t charmap[]);
 
-#ifdef __AVR__
    /*!
     @function
     @abstract   Creates a custom character for use on the LCD.
-    @discussion Create a custom character (glyph) for use on t{he LCD.
+    @discussion Create a custom character (glyph) for use on the LCD.
     Most chipsets only support up to eight characters of 5x8 pixels. Therefore,
     this methods has been limited to locations (numbered 0 to 7).
     
@@ -421,7 +700,71 @@ public:
                 const char str_pstr[] PROGMEM = {0xc, 0x12, 0x12, 0xc, 0, 0, 0, 0};
     */
    void createChar(uint8_t location, const char *charmap);
-#endif // __AVR__
+   
+   /*!
+    @function
+    @abstract   Writes a set of rows of a custom character.
+    @discussion Streams len rows into the CGRAM of the LCD starting at row
+    "row" of the custom character "location". Unlike createChar, the rows are
+    sent back to back without any additional delay than the one needed by the
+    driver and the LCD is left addressing the DDRAM at the cursor position it
+    had before the call, therefore it can be interleaved with text output.
+    
+    This is the method to use to update a subset of the rows of a character
+    that is being displayed, i.e. animations or graphs.
+    
+    The CGRAM is contiguous, rows written past the last row of a character
+    continue on the first row of the next location.
+    
+    @param      location[in] LCD memory location of the character (0 to 7)
+    @param      row[in] first row of the character to write (0 to 7)
+    @param      data[in] rows to write, one byte per row.
+    @param      len[in] number of rows to write.
+    */
+   void writeCGRAM(uint8_t location, uint8_t row, const uint8_t *data, 
+                   uint8_t len);
+   
+   /*!
+    @function
+    @abstract   Loads a packed glyph in the CGRAM.
+    @discussion Expands glyph "index" of a packed glyph set in program memory
+    (@see LCD_GLYPH) and streams it into a CGRAM location. Like writeCGRAM,
+    the LCD is left addressing the DDRAM at the cursor position.
+    
+    @param      location[in] LCD memory location of the character (0 to 7)
+    @param      glyphs[in] packed glyph set in program memory.
+    @param      index[in] glyph of the set to load.
+    */
+   void loadGlyph(uint8_t location, const uint8_t *glyphs, uint16_t index);
+   
+   /*!
+    @function
+    @abstract   Loads several packed glyphs in the CGRAM.
+    @discussion Expands glyphs of a packed glyph set in program memory and
+    streams them in a single upload into consecutive CGRAM locations, starting
+    at "location".
+    
+    @param      location[in] LCD memory location of the first character
+    @param      glyphs[in] packed glyph set in program memory.
+    @param      indices[in] glyphs of the set to load, in RAM.
+    @param      count[in] number of glyphs to load, location + count must not
+    exceed 8.
+    */
+   void loadGlyphs(uint8_t location, const uint8_t *glyphs,
+                   const uint16_t *indices, uint8_t count);
+   
+   /*!
+    @function
+    @abstract   Expands a packed glyph.
+    @discussion Decodes glyph "index" of a packed glyph set in program memory
+    into the 8 bytes per glyph format of createChar.
+    
+    @param      glyphs[in] packed glyph set in program memory.
+    @param      index[in] glyph of the set to expand.
+    @param      rows[out] 8 rows of the glyph.
+    */
+   static void unpackGlyph(const uint8_t *glyphs, uint16_t index,
+                           uint8_t rows[]);
    
    /*!
     @function
@@ -434,6 +777,22 @@ public:
     */
    void setCursor(uint8_t col, uint8_t row);
    
+   /*!
+    @function
+    @abstract   Reads characters from the display.
+    @discussion Reads len characters from the display RAM (DDRAM) starting at
+    a given position. Reading is only possible on drivers that have access to
+    the LCD RW line. The cursor is left after the last character read.
+    
+    @param      col[in] LCD column
+    @param      row[in] LCD row - line.
+    @param      buf[out] buffer where to store the characters read.
+    @param      len[in] number of characters to read.
+    @result     number of characters read, 0 if the driver can't read from the
+    LCD.
+    */
+   uint8_t readScreen(uint8_t col, uint8_t row, uint8_t *buf, uint8_t len);
+   
    /*!
     @function
     @abstract   Switch-on the LCD backlight.
@@ -521,6 +880,22 @@ public:
    virtual size_t write(uint8_t value);
 #endif
    
+   /*!
+    @function
+    @abstract   Writes a buffer to the LCD.
+    @discussion Writes the characters to the LCD from the current cursor
+    position. Drivers able to stream data send them in as few transfers as
+    possible, @see sendBulk. print of strings ends up calling this method.
+    
+    @param      buffer[in] characters to write.
+    @param      size[in] number of characters.
+    */
+#if (ARDUINO <  100)
+   virtual void write(const uint8_t *buffer, size_t size);
+#else
+   virtual size_t write(const uint8_t *buffer, size_t size);
+#endif
+   
 #if (ARDUINO <  100)
    using Print::write;
 #else
@@ -538,8 +913,52 @@ protected:
    uint8_t _numlines;         // Number of lines of the LCD, initialized with begin()
    uint8_t _cols;             // Number of columns in the LCD
    t_backlighPol _polarity;   // Backlight polarity
+   uint8_t _addr;             // Shadow of the LCD DDRAM address counter
+   bool    _cgram;            // The LCD address counter points to the CGRAM
+   uint8_t _xferErrors;       // Transfer errors since the last resync
+   uint16_t _clearExec;       // Execution time of the clear and home (us)
+   uint16_t _pollCost;        // Duration of a busy flag read (us), 0: no polling
+   
+   /*!
+    @function
+    @abstract   Records a transfer error.
+    @discussion Called by the drivers when a transfer to the LCD fails, the
+    nibble phase of a 4 bit interface can't be trusted after it.
+    */
+   void transferError() { if ( _xferErrors < 0xFF ) _xferErrors++; };
+   
+   /*!
+    @function
+    @abstract   Defers a backlight change.
+    @discussion Called by the drivers' setBacklight once the new backlight
+    state is recorded. @see setBacklightLatency
+    @result     true if the change goes out with the next transfer, false if
+    the driver has to write it now.
+    */
+   bool deferBacklight();
    
 private:
+   uint16_t *_deferQueue;     // Deferred mode transfer queue, NULL: immediate
+   uint16_t *_deferHeld;      // Queue of the deferred mode during beginAll
+   uint8_t  _deferSize;       // Number of entries of the queue
+   uint8_t  _deferHead;       // Oldest entry of the queue
+   uint8_t  _deferCount;      // Number of entries queued
+   unsigned long _readyAt;    // Time when the LCD completes the last command
+   uint16_t _xferCost;        // Measured time of a transfer (us)
+   uint16_t _blLatency;       // Maximum delay of a backlight change (ms)
+   bool     _blPending;       // A backlight change waits for a transfer
+   unsigned long _blSince;    // Time of the pending backlight change
+   
+   /*!
+    @function
+    @abstract   Updates the shadow address counter.
+    @discussion Moves the shadow of the DDRAM address counter one position
+    forward or backwards following the DDRAM layout of the LCD (1 or 2 lines).
+    
+    @param      forward[in] true to increment the address, false to decrement it.
+    */
+   void stepAddr(bool forward);
+   
    /*!
     @function
     @abstract   Send a command to the LCD.
@@ -573,6 +992,138 @@ private:
    virtual void send(uint8_t value, uint8_t mode) = 0;
 #endif
    
+   /*!
+    @function
+    @abstract   Receive a value from the LCD.
+    @discussion Reads the busy flag and address counter (COMMAND) or the data
+    at the current address (LCD_DATA) from the LCD. Drivers that can read from
+    the LCD implement this method, the default implementation reports that
+    reading is not available.
+    
+    Users should never call this method.
+    
+    @param      mode[in] COMMAND - busy flag (bit 7) and address counter,
+    LCD_DATA - data in the current DDRAM or CGRAM address.
+    @result     the value read (0..255), -1 if reading is not supported.
+    */
+   virtual int recv(uint8_t /*mode*/) { return ( -1 ); };
+   
+   /*!
+    @function
+    @abstract   Send data to the LCD.
+    @discussion Sends several bytes in LCD_DATA mode. Drivers whose interface
+    can stream data to the LCD implement it, the default implementation sends
+    them one by one.
+    
+    Users should never call this method.
+    
+    @param      data[in] values to send.
+    @param      len[in] number of values.
+    */
+   virtual void sendBulk(const uint8_t *data, uint8_t len);
+   
+   /*!
+    @function
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the communication with the LCD (I2C bus, IO
+    expander, ...) before the LCD initialization sequence. Drivers whose begin
+    method initialises the interface implement it, @see beginAll.
+    */
+   virtual void startInterface() { };
+   
+   /*!
+    @function
+    @abstract   Writes the backlight state.
+    @discussion Writes the recorded backlight state to the interface without
+    sending anything to the LCD. Drivers that support deferred backlight
+    changes implement it, @see deferBacklight.
+    */
+   virtual void writeBacklight() { };
+   
+   /*!
+    @function
+    @abstract   Configures the LCD geometry.
+    @discussion Stores the geometry and font of the LCD, common to begin and
+    beginWarm.
+    */
+   void setGeometry(uint8_t cols, uint8_t lines, uint8_t dotsize);
+   
+   /*!
+    @function
+    @abstract   Resynchronises the LCD interface.
+    @discussion Sends the function set sequence that brings the LCD to the
+    configured interface width (4 or 8 bits) from any state, including a 4 bit
+    interface out of nibble phase. The sequence never clears the display, at
+    most the LCD executes a return home.
+    */
+   void syncInterface();
+   
+   /*!
+    @function
+    @abstract   Sends a step of the interface initialisation sequence.
+    @discussion Sends the function set of a step of the sequence of the
+    datasheet that sets the 4 or 8 bit interface from any state.
+    
+    @param      step[in] step of the sequence, 0 to LCD_INIT_STEPS - 1.
+    */
+   void initStep(uint8_t step);
+   
+   /*!
+    @function
+    @abstract   Transfers a value to the LCD.
+    @discussion Sends the value to the LCD or, in deferred mode, queues it.
+    
+    @param      value[in] value to send.
+    @param      mode[in] COMMAND, LCD_DATA, FOUR_BITS or LCD_DEFER_WAIT.
+    */
+   void transfer(uint8_t value, uint8_t mode);
+   
+   /*!
+    @function
+    @abstract   Transfers data to the LCD.
+    @discussion Sends the values to the LCD in LCD_DATA mode with sendBulk or,
+    in deferred mode, queues them.
+    
+    @param      data[in] values to send.
+    @param      len[in] number of values.
+    */
+   void transferBulk(const uint8_t *data, uint8_t len);
+   
+   /*!
+    @function
+    @abstract   Executes the oldest queued transfer.
+    */
+   void runDeferred();
+   
+   /*!
+    @function
+    @abstract   Wait time after a step of the initialisation sequence.
+    @param      step[in] step of the sequence, 0 to LCD_INIT_STEPS - 1.
+    @result     time to wait in microseconds.
+    */
+   static uint16_t initStepTime(uint8_t step);
+   
+   /*!
+    @function
+    @abstract   Waits for the LCD power up time.
+    @discussion Waits until LCD_POWERUP_MS milliseconds have elapsed since the
+    board was powered up, returns immediately if they already have.
+    */
+   static void powerUpWait();
+   
+   /*!
+    @function
+    @abstract   Waits for the LCD to complete an instruction.
+    @discussion Polls the busy flag if the driver reads it faster than the
+    execution time of the instruction (_pollCost), otherwise waits for the
+    execution time. Drivers opt in to polling setting _pollCost, only when
+    the RW line of the LCD is wired.
+    
+    @param      maxUs[in] worst case execution time of the instruction in
+    microseconds.
+    */
+   void waitReady(uint16_t maxUs);
+   
 };
 
 #endif
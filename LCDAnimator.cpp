@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDAnimator.cpp
+// This file implements a custom character (CGRAM) animation engine for the
+// LCD library.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LCDAnimator.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+/*!
+ @defined
+ @abstract   Maximum number of clean rows uploaded to join two dirty rows.
+ @discussion Every independent upload costs two additional commands (CGRAM
+ address and DDRAM address restore), it is cheaper to rewrite up to 2 rows
+ that didn't change than to start a new upload.
+ */
+#define MAX_ROW_GAP  2
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDAnimator::LCDAnimator ( LCD &lcd ) : _lcd ( lcd )
+{
+   _active   = 0;
+   _next     = 0;
+   _byteCost = LCD_ANIM_BYTE_COST;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// play
+void LCDAnimator::play ( uint8_t location, const uint8_t frames[][8],
+                         uint8_t numFrames, uint16_t period )
+{
+   t_animation &anim = _anim[location & 0x7];
+
+   anim.frames    = frames;
+   anim.numFrames = numFrames;
+   anim.frame     = 0;
+   anim.period    = period;
+   anim.last      = millis ();
+
+   // The contents of the CGRAM are unknown, upload the whole glyph
+   anim.dirty     = 0xFF;
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      anim.rows[i] = pgm_read_byte_near ( &frames[0][i] );
+   }
+   _active |= _BV ( location & 0x7 );
+}
+
+//
+// stop
+void LCDAnimator::stop ( uint8_t location )
+{
+   _active &= ~_BV ( location & 0x7 );
+}
+
+//
+// service
+uint8_t LCDAnimator::service ( uint16_t budget )
+{
+   unsigned long start = micros ();
+   unsigned long now   = millis ();
+   uint8_t pending = 0;
+   bool    outOfTime = false;
+   uint8_t buf[8];
+
+   // Advance the animations that are due, skipping frames if we are late
+   // -------------------------------------------------------------------
+   for ( uint8_t loc = 0; loc < LCD_CGRAM_CHARS; loc++ )
+   {
+      t_animation &anim = _anim[loc];
+
+      if ( ( _active & _BV ( loc ) ) && ( anim.numFrames > 1 ) &&
+           ( anim.period > 0 ) && ( now - anim.last >= anim.period ) )
+      {
+         unsigned long steps = ( now - anim.last ) / anim.period;
+
+         anim.last += steps * anim.period;
+         anim.frame = ( anim.frame + steps ) % anim.numFrames;
+         compare ( anim );
+      }
+   }
+
+   // Upload the dirty rows within the budget, round robin between locations
+   // -----------------------------------------------------------------------
+   for ( uint8_t n = 0; ( n < LCD_CGRAM_CHARS ) && !outOfTime; n++ )
+   {
+      uint8_t loc = ( _next + n ) & 0x7;
+      t_animation &anim = _anim[loc];
+
+      while ( ( _active & _BV ( loc ) ) && ( anim.dirty != 0 ) )
+      {
+         uint8_t first, last, len;
+         unsigned long elapsed, room, t;
+
+         // Find a run of dirty rows, joining small gaps of clean rows
+         for ( first = 0; !( anim.dirty & _BV ( first ) ); first++ );
+         last = first;
+         for ( uint8_t i = first + 1; i < 8; i++ )
+         {
+            if ( ( anim.dirty & _BV ( i ) ) && ( i - last <= MAX_ROW_GAP + 1 ) )
+            {
+               last = i;
+            }
+         }
+         len = last - first + 1;
+
+         // Trim the run to what fits in the remaining budget: CGRAM address,
+         // rows and DDRAM address restore.
+         elapsed = micros () - start;
+         if ( elapsed + 3UL * _byteCost > budget )
+         {
+            // Resume from this location on the next call
+            _next = loc;
+            outOfTime = true;
+            break;
+         }
+         room = ( ( budget - elapsed ) / _byteCost ) - 2;
+         if ( len > room )
+         {
+            len = room;
+         }
+
+         for ( uint8_t i = 0; i < len; i++ )
+         {
+            buf[i] = pgm_read_byte_near ( &anim.frames[anim.frame][first + i] );
+         }
+
+         t = micros ();
+         _lcd.writeCGRAM ( loc, first, buf, len );
+         t = micros () - t;
+
+         // Track the cost of a transfer to plan the next uploads
+         _byteCost = ( ( 3UL * _byteCost ) + ( t / ( len + 2 ) ) ) / 4;
+         if ( _byteCost == 0 )
+         {
+            _byteCost = 1;
+         }
+
+         for ( uint8_t i = 0; i < len; i++ )
+         {
+            anim.rows[first + i] = buf[i];
+            anim.dirty &= ~_BV ( first + i );
+         }
+      }
+   }
+   if ( !outOfTime )
+   {
+      _next = ( _next + 1 ) & 0x7;
+   }
+
+   for ( uint8_t loc = 0; loc < LCD_CGRAM_CHARS; loc++ )
+   {
+      if ( _active & _BV ( loc ) )
+      {
+         for ( uint8_t i = 0; i < 8; i++ )
+         {
+            pending += ( _anim[loc].dirty >> i ) & 0x1;
+         }
+      }
+   }
+   return ( pending );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// compare
+void LCDAnimator::compare ( t_animation &anim )
+{
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      if ( pgm_read_byte_near ( &anim.frames[anim.frame][i] ) != anim.rows[i] )
+      {
+         anim.dirty |= _BV ( i );
+      }
+   }
+}
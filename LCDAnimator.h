@@ -0,0 +1,141 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDAnimator.h
+// This file implements a custom character (CGRAM) animation engine for the
+// LCD library.
+//
+// @brief
+// The animator takes ownership of a set of CGRAM locations of an LCD and
+// plays on each of them a sequence of frames stored in program memory at a
+// given rate (spinners, battery charge, signal strength icons, ...).
+//
+// The application calls service() from its main loop. Each call advances the
+// animations that are due and uploads to the LCD only the rows of the glyphs
+// that differ from what is already in the CGRAM, stopping when the time budget
+// given for the call is consumed. Pending rows are uploaded on the next calls.
+// If an animation advances more than one frame before its rows have been
+// uploaded, the intermediate frames are skipped.
+//
+// Frames are 8 bytes each (one per row), in the same format as createChar:
+//    const uint8_t spinner[][8] PROGMEM = { {...}, {...}, ... };
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_ANIMATOR_H_
+#define _LCD_ANIMATOR_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Number of CGRAM locations of the LCD.
+ @discussion Maximum number of animations that can be played concurrently.
+ */
+#define LCD_CGRAM_CHARS     8
+
+/*!
+ @defined
+ @abstract   Initial estimate of the time to send a byte to the LCD.
+ @discussion Time in microseconds used to plan the first upload before the
+ animator has measured the real cost of the driver in use. It is the byte
+ transfer time of an I2C backpack at 100kHz.
+ */
+#define LCD_ANIM_BYTE_COST  500
+
+class LCDAnimator
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Attaches the animator to an LCD. The LCD has to be initialised
+    (begin) before calling service.
+
+    @param      lcd[in] LCD where the animations are played.
+    */
+   LCDAnimator ( LCD &lcd );
+
+   /*!
+    @function
+    @abstract   Plays an animation on a CGRAM location.
+    @discussion Associates a frame sequence to a CGRAM location, the location
+    is owned by the animator from then on. The first frame is uploaded by the
+    next calls to service. The animation loops over all its frames.
+
+    @param      location[in] CGRAM location to animate (0 to 7).
+    @param      frames[in] frame sequence in program memory, 8 bytes per frame.
+    @param      numFrames[in] number of frames of the sequence.
+    @param      period[in] time each frame is displayed in milliseconds.
+    */
+   void play ( uint8_t location, const uint8_t frames[][8], uint8_t numFrames,
+               uint16_t period );
+
+   /*!
+    @function
+    @abstract   Stops an animation.
+    @discussion Freezes the animation on a location and releases the location.
+    Rows of the current frame that are still pending are not uploaded.
+
+    @param      location[in] CGRAM location to release (0 to 7).
+    */
+   void stop ( uint8_t location );
+
+   /*!
+    @function
+    @abstract   Advances and uploads the animations.
+    @discussion Advances the animations that are due and uploads to the LCD
+    the glyph rows that changed. The method returns once all pending rows are
+    uploaded or when the next upload wouldn't fit in the time budget.
+
+    The time needed to send a byte is measured on every upload, the budget
+    is honoured within the granularity of one LCD transfer. If the budget is
+    lower than the time needed to upload a single row, nothing is uploaded.
+
+    @param      budget[in] maximum time in microseconds to spend in the call.
+    @result     number of glyph rows still pending upload.
+    */
+   uint8_t service ( uint16_t budget );
+
+private:
+   /*!
+    @typedef
+    @abstract   Animation state of a CGRAM location.
+    */
+   typedef struct
+   {
+      const uint8_t (*frames)[8]; // Frame sequence in program memory
+      uint8_t  numFrames;         // Number of frames in the sequence
+      uint8_t  frame;             // Frame to be displayed
+      uint16_t period;            // Frame period in ms
+      unsigned long last;         // Time when the frame was selected
+      uint8_t  rows[8];           // Rows currently stored in the CGRAM
+      uint8_t  dirty;             // Rows that differ from the frame (bitmask)
+   } t_animation;
+
+   /*!
+    @function
+    @abstract   Computes the rows of a location that need uploading.
+    @param      anim[in] animation to refresh.
+    */
+   void compare ( t_animation &anim );
+
+   LCD         &_lcd;                  // LCD where the animation is played
+   t_animation _anim[LCD_CGRAM_CHARS]; // Animation state per CGRAM location
+   uint8_t     _active;                // Locations owned by the animator
+   uint8_t     _next;                  // Next location to upload (round robin)
+   uint16_t    _byteCost;              // Measured time to send a byte (us)
+};
+
+#endif
@@ -0,0 +1,218 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDCanvas.cpp
+// This file implements a small bitmap canvas on the custom characters of an
+// LCD.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include <inttypes.h>
+#include "LCDCanvas.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+/*!
+ @defined
+ @abstract   Maximum number of clean rows uploaded to join two dirty rows.
+ @discussion Every independent upload costs two additional commands (CGRAM
+ address and DDRAM address restore).
+ */
+#define MAX_ROW_GAP  2
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDCanvas::LCDCanvas ( LCD &lcd, uint8_t cols, uint8_t rows,
+                       uint8_t location ) : _lcd ( lcd )
+{
+   _cols     = cols;
+   _rows     = rows;
+   _location = location;
+
+   // The contents of the CGRAM are unknown, upload the whole canvas
+   memset ( _bitmap, 0, sizeof ( _bitmap ) );
+   memset ( _dirty, 0xFF, sizeof ( _dirty ) );
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// place
+void LCDCanvas::place ( uint8_t col, uint8_t row )
+{
+   for ( uint8_t r = 0; r < _rows; r++ )
+   {
+      _lcd.setCursor ( col, row + r );
+      for ( uint8_t c = 0; c < _cols; c++ )
+      {
+         _lcd.write ( _location + ( r * _cols ) + c );
+      }
+   }
+}
+
+//
+// clear
+void LCDCanvas::clear ( void )
+{
+   for ( uint8_t i = 0; i < _cols * _rows * LCD_CHAR_HEIGHT; i++ )
+   {
+      putRow ( i, 0 );
+   }
+}
+
+//
+// setPixel
+void LCDCanvas::setPixel ( uint8_t x, uint8_t y, bool on )
+{
+   vLine ( x, y, y, on );
+}
+
+//
+// getPixel
+bool LCDCanvas::getPixel ( uint8_t x, uint8_t y )
+{
+   uint8_t index;
+
+   if ( ( x >= width () ) || ( y >= height () ) )
+   {
+      return ( false );
+   }
+   index = ( ( ( ( y / LCD_CHAR_HEIGHT ) * _cols ) + ( x / LCD_CHAR_WIDTH ) ) *
+             LCD_CHAR_HEIGHT ) + ( y % LCD_CHAR_HEIGHT );
+
+   return ( _bitmap[index] & _BV ( LCD_CHAR_WIDTH - 1 - ( x % LCD_CHAR_WIDTH ) ) );
+}
+
+//
+// vLine
+void LCDCanvas::vLine ( uint8_t x, uint8_t y0, uint8_t y1, bool on )
+{
+   uint8_t bit;
+   uint8_t column;
+
+   if ( y0 > y1 )
+   {
+      uint8_t tmp = y0;
+      y0 = y1;
+      y1 = tmp;
+   }
+   if ( ( x >= width () ) || ( y0 >= height () ) )
+   {
+      return;
+   }
+   if ( y1 >= height () )
+   {
+      y1 = height () - 1;
+   }
+
+   bit    = _BV ( LCD_CHAR_WIDTH - 1 - ( x % LCD_CHAR_WIDTH ) );
+   column = x / LCD_CHAR_WIDTH;
+
+   for ( uint8_t y = y0; y <= y1; y++ )
+   {
+      uint8_t index = ( ( ( ( y / LCD_CHAR_HEIGHT ) * _cols ) + column ) *
+                        LCD_CHAR_HEIGHT ) + ( y % LCD_CHAR_HEIGHT );
+
+      putRow ( index, on ? ( _bitmap[index] | bit ) : ( _bitmap[index] & ~bit ) );
+   }
+}
+
+//
+// scrollLeft
+void LCDCanvas::scrollLeft ( void )
+{
+   for ( uint8_t r = 0; r < _rows; r++ )
+   {
+      for ( uint8_t c = 0; c < _cols; c++ )
+      {
+         uint8_t index = ( ( r * _cols ) + c ) * LCD_CHAR_HEIGHT;
+
+         for ( uint8_t y = 0; y < LCD_CHAR_HEIGHT; y++, index++ )
+         {
+            uint8_t value = ( _bitmap[index] << 1 ) & ( _BV ( LCD_CHAR_WIDTH ) - 1 );
+
+            // Leftmost column of the character on the right
+            if ( c + 1 < _cols )
+            {
+               value |= _bitmap[index + LCD_CHAR_HEIGHT] >> ( LCD_CHAR_WIDTH - 1 );
+            }
+            putRow ( index, value );
+         }
+      }
+   }
+}
+
+//
+// flush
+uint8_t LCDCanvas::flush ( void )
+{
+   uint8_t numRows = _cols * _rows * LCD_CHAR_HEIGHT;
+   uint8_t uploaded = 0;
+   uint8_t i = 0;
+
+   while ( i < numRows )
+   {
+      uint8_t first, last, addr;
+
+      if ( !( _dirty[i / LCD_CHAR_HEIGHT] & _BV ( i % LCD_CHAR_HEIGHT ) ) )
+      {
+         i++;
+         continue;
+      }
+
+      // Find a run of dirty rows, joining small gaps of clean rows. The CGRAM
+      // is contiguous, a run may continue on the next character.
+      first = i;
+      last  = i;
+      for ( i = first + 1; ( i < numRows ) && ( i - last <= MAX_ROW_GAP + 1 ); i++ )
+      {
+         if ( _dirty[i / LCD_CHAR_HEIGHT] & _BV ( i % LCD_CHAR_HEIGHT ) )
+         {
+            last = i;
+         }
+      }
+      i = last + 1;
+
+      addr = ( _location * LCD_CHAR_HEIGHT ) + first;
+      _lcd.writeCGRAM ( addr / LCD_CHAR_HEIGHT, addr % LCD_CHAR_HEIGHT,
+                        &_bitmap[first], last - first + 1 );
+      uploaded += last - first + 1;
+   }
+
+   memset ( _dirty, 0, sizeof ( _dirty ) );
+   return ( uploaded );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// putRow
+void LCDCanvas::putRow ( uint8_t index, uint8_t value )
+{
+   if ( _bitmap[index] != value )
+   {
+      _bitmap[index] = value;
+      _dirty[index / LCD_CHAR_HEIGHT] |= _BV ( index % LCD_CHAR_HEIGHT );
+   }
+}
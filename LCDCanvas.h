@@ -0,0 +1,179 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDCanvas.h
+// This file implements a small bitmap canvas on the custom characters of an
+// LCD.
+//
+// @brief
+// The canvas maps a block of up to 8 custom characters (CGRAM locations) to
+// a pixel grid. A block of 4x2 characters gives a 20x16 pixels canvas, enough
+// for small graphs and icons.
+//
+// Drawing is done on a RAM copy of the glyphs, nothing is sent to the LCD
+// until flush() is called. flush() uploads only the glyph rows modified since
+// the previous flush, a plot that changes a few pixels costs a few bytes
+// rather than the 64 bytes of the whole CGRAM.
+//
+// The block of characters is displayed with place(), after that the canvas
+// only needs flushing:
+//    LCDCanvas canvas(lcd, 4, 2);
+//    canvas.place(0, 0);
+//    canvas.setPixel(x, y);
+//    canvas.flush();
+//
+// Pixel (0,0) is the upper-left corner. The gap between characters of the
+// LCD is not part of the canvas.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_CANVAS_H_
+#define _LCD_CANVAS_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Number of CGRAM locations of the LCD.
+ @discussion Maximum number of characters of the canvas.
+ */
+#ifndef LCD_CGRAM_CHARS
+#define LCD_CGRAM_CHARS     8
+#endif
+
+/*!
+ @defined
+ @abstract   Size of a character in pixels.
+ */
+#define LCD_CHAR_WIDTH      5
+#define LCD_CHAR_HEIGHT     8
+
+class LCDCanvas
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Creates a blank canvas of cols x rows characters using the
+    CGRAM locations from "location" onwards, row by row. The locations are
+    owned by the canvas. The whole canvas is uploaded by the first flush.
+
+    @param      lcd[in] LCD where the canvas is displayed.
+    @param      cols[in] width of the canvas in characters.
+    @param      rows[in] height of the canvas in characters.
+    @param      location[in] first CGRAM location used, location + cols * rows
+    must not exceed 8.
+    */
+   LCDCanvas ( LCD &lcd, uint8_t cols, uint8_t rows, uint8_t location = 0 );
+
+   /*!
+    @function
+    @abstract   Canvas width in pixels.
+    */
+   uint8_t width ( void ) { return ( _cols * LCD_CHAR_WIDTH ); };
+
+   /*!
+    @function
+    @abstract   Canvas height in pixels.
+    */
+   uint8_t height ( void ) { return ( _rows * LCD_CHAR_HEIGHT ); };
+
+   /*!
+    @function
+    @abstract   Displays the canvas.
+    @discussion Writes the characters of the canvas on the LCD with its
+    upper-left corner at the given position. The LCD cursor is left after the
+    last character of the canvas.
+
+    @param      col[in] LCD column of the upper-left character.
+    @param      row[in] LCD row of the upper-left character.
+    */
+   void place ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Blanks the canvas.
+    */
+   void clear ( void );
+
+   /*!
+    @function
+    @abstract   Sets the state of a pixel.
+    @discussion Pixels outside the canvas are ignored.
+
+    @param      x[in] pixel column.
+    @param      y[in] pixel row.
+    @param      on[in] true to light the pixel, false to clear it.
+    */
+   void setPixel ( uint8_t x, uint8_t y, bool on = true );
+
+   /*!
+    @function
+    @abstract   Reads the state of a pixel.
+    @param      x[in] pixel column.
+    @param      y[in] pixel row.
+    @result     true if the pixel is lit, false if clear or outside the canvas.
+    */
+   bool getPixel ( uint8_t x, uint8_t y );
+
+   /*!
+    @function
+    @abstract   Draws a vertical line.
+    @discussion Sets the pixels of column x from y0 to y1 (both included), the
+    building block of bar and trend graphs.
+
+    @param      x[in] pixel column.
+    @param      y0[in] first pixel row.
+    @param      y1[in] last pixel row.
+    @param      on[in] true to light the pixels, false to clear them.
+    */
+   void vLine ( uint8_t x, uint8_t y0, uint8_t y1, bool on = true );
+
+   /*!
+    @function
+    @abstract   Scrolls the canvas one pixel to the left.
+    @discussion Shifts the pixel columns left, carrying them across characters.
+    The leftmost column is lost and the rightmost one is left blank. Only the
+    glyph rows whose bits change are flagged for upload.
+    */
+   void scrollLeft ( void );
+
+   /*!
+    @function
+    @abstract   Uploads the changes to the LCD.
+    @discussion Writes in the CGRAM the glyph rows that changed since the last
+    flush. Consecutive rows are streamed in a single upload, even across
+    characters.
+    @result     number of glyph rows uploaded.
+    */
+   uint8_t flush ( void );
+
+private:
+   /*!
+    @function
+    @abstract   Stores a glyph row, flagging it for upload if it changes.
+    @param      index[in] row index in the bitmap (character * 8 + row).
+    @param      value[in] row bits.
+    */
+   void putRow ( uint8_t index, uint8_t value );
+
+   LCD     &_lcd;                       // LCD where the canvas is displayed
+   uint8_t _bitmap[LCD_CGRAM_CHARS * LCD_CHAR_HEIGHT]; // Glyph rows
+   uint8_t _dirty[LCD_CGRAM_CHARS];     // Rows pending upload, per character
+   uint8_t _cols;                       // Width in characters
+   uint8_t _rows;                       // Height in characters
+   uint8_t _location;                   // First CGRAM location
+};
+
+#endif
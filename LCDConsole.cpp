@@ -0,0 +1,278 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDConsole.cpp
+// This file implements a scrolling terminal (console) for the LCD library.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include <inttypes.h>
+#include "LCDConsole.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+#define NO_CELL      0xFFFF
+#define ESC          0x1B
+
+// Escape sequence parser states
+#define ESC_NONE     0     // Not in an escape sequence
+#define ESC_START    1     // ESC received
+#define ESC_PARAMS   2     // ESC [ received, parsing parameters
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDConsole::LCDConsole ( LCD &lcd, uint8_t cols, uint8_t rows,
+                         uint8_t *buffer ) : _lcd ( lcd )
+{
+   _screen    = buffer;
+   _cols      = cols;
+   _rows      = rows;
+   _col       = 0;
+   _row       = 0;
+   _lcdCursor = NO_CELL;
+   _escState  = ESC_NONE;
+
+   memset ( _screen, ' ', (uint16_t)cols * rows );
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// clear
+void LCDConsole::clear ( void )
+{
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      clearLine ( row, 0 );
+   }
+   _col = 0;
+   _row = 0;
+}
+
+//
+// setCursor
+void LCDConsole::setCursor ( uint8_t col, uint8_t row )
+{
+   _col = ( col < _cols ) ? col : _cols - 1;
+   _row = ( row < _rows ) ? row : _rows - 1;
+}
+
+//
+// write
+#if (ARDUINO <  100)
+void LCDConsole::write ( uint8_t value )
+#else
+size_t LCDConsole::write ( uint8_t value )
+#endif
+{
+   if ( _escState != ESC_NONE )
+   {
+      escape ( value );
+   }
+   else
+   {
+      switch ( value )
+      {
+         case '\n':
+            newLine ();
+            break;
+
+         case '\r':
+            _col = 0;
+            break;
+
+         case '\b':
+            if ( _col >= _cols )
+            {
+               _col = _cols - 1;
+            }
+            if ( _col > 0 )
+            {
+               _col--;
+            }
+            break;
+
+         case '\t':
+            if ( _col < _cols )
+            {
+               _col = ( ( _col / LCD_CONSOLE_TAB ) + 1 ) * LCD_CONSOLE_TAB;
+               if ( _col >= _cols )
+               {
+                  _col = _cols - 1;
+               }
+            }
+            break;
+
+         case ESC:
+            _escState = ESC_START;
+            break;
+
+         default:
+            // Wrap when a character follows a full row, a new line at the end
+            // of a full row doesn't leave an empty line
+            if ( _col >= _cols )
+            {
+               newLine ();
+            }
+            putCell ( _col, _row, value );
+            _col++;
+            break;
+      }
+   }
+#if (ARDUINO >=  100)
+   return ( 1 );
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// newLine
+void LCDConsole::newLine ( void )
+{
+   _col = 0;
+   if ( _row < _rows - 1 )
+   {
+      _row++;
+   }
+   else
+   {
+      scroll ();
+   }
+}
+
+//
+// scroll
+void LCDConsole::scroll ( void )
+{
+   for ( uint8_t row = 0; row < _rows - 1; row++ )
+   {
+      uint8_t *next = &_screen[( row + 1 ) * _cols];
+
+      for ( uint8_t col = 0; col < _cols; col++ )
+      {
+         putCell ( col, row, next[col] );
+      }
+   }
+   clearLine ( _rows - 1, 0 );
+}
+
+//
+// clearLine
+void LCDConsole::clearLine ( uint8_t row, uint8_t from )
+{
+   for ( uint8_t col = from; col < _cols; col++ )
+   {
+      putCell ( col, row, ' ' );
+   }
+}
+
+//
+// escape
+void LCDConsole::escape ( uint8_t value )
+{
+   if ( _escState == ESC_START )
+   {
+      if ( value == '[' )
+      {
+         _escState    = ESC_PARAMS;
+         _escCount    = 0;
+         _escParam[0] = 0;
+         _escParam[1] = 0;
+      }
+      else
+      {
+         _escState = ESC_NONE;
+      }
+      return;
+   }
+
+   if ( ( value >= '0' ) && ( value <= '9' ) )
+   {
+      if ( _escCount < 2 )
+      {
+         _escParam[_escCount] = ( _escParam[_escCount] * 10 ) + ( value - '0' );
+      }
+      return;
+   }
+   if ( value == ';' )
+   {
+      _escCount++;
+      return;
+   }
+
+   // Final character of the sequence
+   _escState = ESC_NONE;
+   switch ( value )
+   {
+      case 'H':
+      case 'f':
+         setCursor ( ( _escParam[1] > 0 ) ? _escParam[1] - 1 : 0,
+                     ( _escParam[0] > 0 ) ? _escParam[0] - 1 : 0 );
+         break;
+
+      case 'K':
+         if ( _col < _cols )
+         {
+            clearLine ( _row, _col );
+         }
+         break;
+
+      case 'J':
+         if ( _escParam[0] == 2 )
+         {
+            uint8_t col = _col;
+            uint8_t row = _row;
+
+            // Clearing the screen doesn't move the cursor
+            clear ();
+            _col = col;
+            _row = row;
+         }
+         break;
+   }
+}
+
+//
+// putCell
+void LCDConsole::putCell ( uint8_t col, uint8_t row, uint8_t value )
+{
+   uint16_t cell = ( row * _cols ) + col;
+
+   if ( _screen[cell] == value )
+   {
+      return;
+   }
+   _screen[cell] = value;
+
+   if ( cell != _lcdCursor )
+   {
+      _lcd.setCursor ( col, row );
+   }
+   _lcd.write ( value );
+
+   // The DDRAM is not continuous between rows, the next write after the last
+   // column of a row needs repositioning.
+   _lcdCursor = ( col + 1 == _cols ) ? NO_CELL : cell + 1;
+}
@@ -0,0 +1,162 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDConsole.h
+// This file implements a scrolling terminal (console) for the LCD library.
+//
+// @brief
+// The console turns an LCD into a small terminal for log style output using
+// the regular Print methods: text wraps at the end of a row and, when the
+// last row overflows, all the rows scroll up one line.
+//
+// The console keeps a RAM copy of the screen. Only the characters that
+// differ from what is already on the LCD are sent: scrolling rewrites the
+// cells that change, not the whole screen, and there is no clear.
+//
+// Control characters:
+//    '\n'  new line (moves to the first column of the next row)
+//    '\r'  carriage return (moves to the first column)
+//    '\b'  backspace (moves one column left)
+//    '\t'  tab (moves to the next tab stop, every LCD_CONSOLE_TAB columns)
+// Escape sequences (ESC [ ...):
+//    ESC [ row ; col H   cursor position, 1 based, defaults to 1;1
+//    ESC [ K             clear to the end of the line
+//    ESC [ 2 J           clear the screen
+// Other escape sequences are ignored.
+//
+// The buffer is provided by the application, it must hold cols * rows bytes:
+//    uint8_t screen[20 * 4];
+//    LCDConsole console(lcd, 20, 4, screen);
+//
+// All the output to the LCD is expected to be done through the console.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_CONSOLE_H_
+#define _LCD_CONSOLE_H_
+
+#include <inttypes.h>
+#include <Print.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Console tab stops.
+ @discussion Distance in columns between tab stops.
+ */
+#ifndef LCD_CONSOLE_TAB
+#define LCD_CONSOLE_TAB   4
+#endif
+
+class LCDConsole : public Print
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initialises the console with a blank screen and the cursor in
+    the upper-left corner. The LCD has to be initialised (begin) and blank
+    before writing to the console.
+
+    @param      lcd[in] LCD used as terminal.
+    @param      cols[in] number of columns of the LCD.
+    @param      rows[in] number of rows of the LCD.
+    @param      buffer[in] screen storage, cols * rows bytes.
+    */
+   LCDConsole ( LCD &lcd, uint8_t cols, uint8_t rows, uint8_t *buffer );
+
+   /*!
+    @function
+    @abstract   Clears the console.
+    @discussion Blanks the screen and moves the cursor to the upper-left
+    corner. Only the characters that were not blank are sent to the LCD.
+    */
+   void clear ( void );
+
+   /*!
+    @function
+    @abstract   Positions the console cursor.
+    @param      col[in] column.
+    @param      row[in] row.
+    */
+   void setCursor ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Writes to the console.
+    @discussion Writes a character or processes a control character or escape
+    sequence.
+
+    @param      value[in] character to write.
+    */
+#if (ARDUINO <  100)
+   virtual void write ( uint8_t value );
+#else
+   virtual size_t write ( uint8_t value );
+#endif
+   using Print::write;
+
+private:
+   /*!
+    @function
+    @abstract   Moves the cursor to the next line, scrolling if needed.
+    */
+   void newLine ( void );
+
+   /*!
+    @function
+    @abstract   Scrolls the screen up one line.
+    @discussion Sends to the LCD only the cells that change.
+    */
+   void scroll ( void );
+
+   /*!
+    @function
+    @abstract   Blanks part of a row.
+    @param      row[in] row.
+    @param      from[in] first column to blank.
+    */
+   void clearLine ( uint8_t row, uint8_t from );
+
+   /*!
+    @function
+    @abstract   Processes a character of an escape sequence.
+    @param      value[in] character received.
+    */
+   void escape ( uint8_t value );
+
+   /*!
+    @function
+    @abstract   Updates a cell of the screen.
+    @discussion Stores a character in the screen and sends it to the LCD if
+    it changes, positioning the LCD cursor only if needed.
+
+    @param      col[in] column.
+    @param      row[in] row.
+    @param      value[in] character.
+    */
+   void putCell ( uint8_t col, uint8_t row, uint8_t value );
+
+   LCD      &_lcd;        // LCD used as terminal
+   uint8_t  *_screen;     // RAM copy of the screen
+   uint8_t  _cols;        // Number of columns
+   uint8_t  _rows;        // Number of rows
+   uint8_t  _col;         // Cursor column, _cols: wrap pending
+   uint8_t  _row;         // Cursor row
+   uint16_t _lcdCursor;   // Cell where the LCD cursor is, 0xFFFF unknown
+   uint8_t  _escState;    // Escape sequence parser state
+   uint8_t  _escParam[2]; // Escape sequence parameters
+   uint8_t  _escCount;    // Index of the parameter being parsed
+};
+
+#endif
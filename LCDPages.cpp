@@ -0,0 +1,281 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDPages.cpp
+// This file implements a set of in RAM screen pages for the LCD library.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include <inttypes.h>
+#include "LCDPages.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+#define NO_CELL   0xFFFF
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDPages::LCDPages ( LCD &lcd, uint8_t cols, uint8_t rows, uint8_t *buffer,
+                     uint8_t numPages ) : _lcd ( lcd )
+{
+   _buffer    = buffer;
+   _cols      = cols;
+   _rows      = rows;
+   _numPages  = numPages;
+   _shown     = LCD_NO_PAGE;
+   _selected  = 0;
+   _col       = 0;
+   _row       = 0;
+   _lcdCursor = NO_CELL;
+   _refreshPos  = 0;
+   _refreshStep = 0;
+   _refreshLast = 0;
+   _refreshCost = LCD_REFRESH_CELL_COST;
+
+   memset ( _buffer, ' ', (uint16_t)cols * rows * numPages );
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// showPage
+void LCDPages::showPage ( uint8_t page )
+{
+   uint16_t size = (uint16_t)_cols * _rows;
+   uint8_t *next;
+   uint8_t *prev;
+
+   if ( ( page >= _numPages ) || ( page == _shown ) )
+   {
+      return;
+   }
+
+   next = &_buffer[page * size];
+   prev = ( _shown != LCD_NO_PAGE ) ? &_buffer[_shown * size] : NULL;
+
+   for ( uint16_t cell = 0; cell < size; cell++ )
+   {
+      if ( ( prev == NULL ) || ( next[cell] != prev[cell] ) )
+      {
+         sendCell ( cell, next[cell] );
+      }
+   }
+   _shown = page;
+}
+
+//
+// loadPage
+bool LCDPages::loadPage ( uint8_t page )
+{
+   uint8_t *dest;
+
+   if ( page >= _numPages )
+   {
+      return ( false );
+   }
+
+   dest = &_buffer[page * _rows * _cols];
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      if ( _lcd.readScreen ( 0, row, &dest[row * _cols], _cols ) != _cols )
+      {
+         return ( false );
+      }
+   }
+   _shown     = page;
+   _lcdCursor = NO_CELL;
+   return ( true );
+}
+
+//
+// redraw
+void LCDPages::redraw ( void )
+{
+   uint8_t page = _shown;
+
+   // Showing the page as if no page was on display writes all the cells
+   _shown     = LCD_NO_PAGE;
+   _lcdCursor = NO_CELL;
+   showPage ( page );
+}
+
+//
+// setRefreshPeriod
+void LCDPages::setRefreshPeriod ( uint16_t period )
+{
+   // Spread the cells and the LCD configuration over the period
+   unsigned long step = ( period * 1000UL ) / ( ( _cols * _rows ) + 1 );
+
+   if ( ( period != 0 ) && ( step == 0 ) )
+   {
+      step = 1;
+   }
+   _refreshStep = ( step > 0xFFFF ) ? 0xFFFF : step;
+   _refreshLast = millis ();
+}
+
+//
+// refresh
+void LCDPages::refresh ( uint16_t budget )
+{
+   uint16_t size = (uint16_t)_cols * _rows;
+   unsigned long start = micros ();
+   unsigned long now   = millis ();
+   unsigned long t;
+
+   if ( ( _refreshStep == 0 ) || ( _shown == LCD_NO_PAGE ) )
+   {
+      return;
+   }
+
+   // Don't try to catch up with more than one whole refresh
+   if ( now - _refreshLast > (unsigned long)_refreshStep * ( size + 1 ) )
+   {
+      _refreshLast = now - (unsigned long)_refreshStep * ( size + 1 );
+   }
+
+   while ( now - _refreshLast >= _refreshStep )
+   {
+      if ( micros () - start + _refreshCost > budget )
+      {
+         // Let a cost estimate inflated by a slow transfer decay, otherwise
+         // a budget below it would stop the refresh for good
+         _refreshCost -= ( _refreshCost + 7 ) / 8;
+         break;
+      }
+
+      t = micros ();
+      if ( _refreshPos < size )
+      {
+         sendCell ( _refreshPos, _buffer[( _shown * size ) + _refreshPos] );
+         _refreshPos++;
+      }
+      else
+      {
+         _lcd.restoreConfig ();
+         _refreshPos = 0;
+      }
+      t = micros () - t;
+
+      // Track the cost of a refresh to plan the next ones
+      _refreshCost = ( ( 3UL * _refreshCost ) + t ) / 4;
+      _refreshLast += _refreshStep;
+   }
+}
+
+//
+// selectPage
+void LCDPages::selectPage ( uint8_t page )
+{
+   if ( page < _numPages )
+   {
+      _selected = page;
+      _col      = 0;
+      _row      = 0;
+   }
+}
+
+//
+// setCursor
+void LCDPages::setCursor ( uint8_t col, uint8_t row )
+{
+   if ( row >= _rows )
+   {
+      row = _rows - 1;
+   }
+   _col = col;
+   _row = row;
+}
+
+//
+// clear
+void LCDPages::clear ( void )
+{
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      setCursor ( 0, row );
+      for ( uint8_t col = 0; col < _cols; col++ )
+      {
+         write ( ' ' );
+      }
+   }
+   setCursor ( 0, 0 );
+}
+
+//
+// write
+#if (ARDUINO <  100)
+void LCDPages::write ( uint8_t value )
+#else
+size_t LCDPages::write ( uint8_t value )
+#endif
+{
+   uint16_t cell;
+
+   // Discard characters beyond the end of the row
+   // --------------------------------------------
+   if ( _col >= _cols )
+   {
+#if (ARDUINO <  100)
+      return;
+#else
+      return ( 0 );
+#endif
+   }
+
+   cell = ( _row * _cols ) + _col;
+   _col++;
+
+   // Update the page and the LCD if the page is on display and the
+   // character changes
+   // -------------------------------------------------------------
+   if ( _buffer[( _selected * _rows * _cols ) + cell] != value )
+   {
+      _buffer[( _selected * _rows * _cols ) + cell] = value;
+      if ( _selected == _shown )
+      {
+         sendCell ( cell, value );
+      }
+   }
+#if (ARDUINO >=  100)
+   return ( 1 );
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// sendCell
+void LCDPages::sendCell ( uint16_t cell, uint8_t value )
+{
+   if ( cell != _lcdCursor )
+   {
+      _lcd.setCursor ( cell % _cols, cell / _cols );
+   }
+   _lcd.write ( value );
+
+   // The DDRAM is not continuous between rows, the next write after the last
+   // column of a row needs repositioning.
+   _lcdCursor = ( ( cell + 1 ) % _cols == 0 ) ? NO_CELL : cell + 1;
+}
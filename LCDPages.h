@@ -0,0 +1,222 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDPages.h
+// This file implements a set of in RAM screen pages for the LCD library.
+//
+// @brief
+// Applications with several screens (main, alarms, settings, ...) can keep
+// each screen in its own page, a RAM copy of the whole display. Pages are
+// written using the regular Print methods (print, write, ...) and can be
+// updated while they are not visible without any traffic to the LCD.
+//
+// Switching the page shown (showPage) only sends to the LCD the characters
+// that differ between the page on the display and the new page, no clear and
+// full redraw is needed. Writes to the page being displayed are sent to the
+// LCD only if they change the character on the display.
+//
+// The page buffer is provided by the application, it must hold
+// cols * rows * numPages bytes:
+//    uint8_t pageBuffer[16 * 2 * 3];
+//    LCDPages pages(lcd, 16, 2, pageBuffer, 3);
+//
+// All the output to the LCD is expected to be done through the pages, the
+// text direction has to be left to right (default).
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_PAGES_H_
+#define _LCD_PAGES_H_
+
+#include <inttypes.h>
+#include <Print.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   No page is displayed.
+ @discussion Value of the page shown before the first call to showPage.
+ */
+#define LCD_NO_PAGE    0xFF
+
+/*!
+ @defined
+ @abstract   Initial estimate of the time to refresh a cell.
+ @discussion Time in microseconds used to plan the first background refresh
+ before the real cost of the driver in use has been measured. It is the time
+ to position the cursor and write a character on an I2C backpack at 100kHz.
+ */
+#define LCD_REFRESH_CELL_COST  1000
+
+class LCDPages : public Print
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initialises the pages with blanks. No page is shown until
+    showPage is called. The LCD has to be initialised (begin) before showing
+    a page.
+
+    @param      lcd[in] LCD where the pages are displayed.
+    @param      cols[in] number of columns of the LCD.
+    @param      rows[in] number of rows of the LCD.
+    @param      buffer[in] page storage, cols * rows * numPages bytes.
+    @param      numPages[in] number of pages.
+    */
+   LCDPages ( LCD &lcd, uint8_t cols, uint8_t rows, uint8_t *buffer,
+              uint8_t numPages );
+
+   /*!
+    @function
+    @abstract   Displays a page.
+    @discussion Makes a page the one shown on the LCD sending only the
+    characters that differ from the page currently displayed. The first time
+    a page is shown the whole page is written (the contents of the LCD are not
+    known) without clearing the LCD.
+
+    @param      page[in] page to display (0 to numPages - 1).
+    */
+   void showPage ( uint8_t page );
+
+   /*!
+    @function
+    @abstract   Loads a page from the LCD.
+    @discussion Reads the contents of the LCD into a page and makes it the
+    page shown. Used after a warm start (LCD::beginWarm) to recover the screen
+    that survived the MCU reset, subsequent page switches are then diffed
+    against what really is on the display. Requires a driver that supports
+    reading from the LCD (RW line wired).
+
+    @param      page[in] page to load (0 to numPages - 1).
+    @result     true if the page was loaded, false if the LCD can't be read.
+    */
+   bool loadPage ( uint8_t page );
+
+   /*!
+    @function
+    @abstract   Redraws the page shown.
+    @discussion Writes again the whole page shown to the LCD, used to restore
+    the display when its contents can't be trusted, for example after
+    LCD::checkSync has resynchronised the LCD.
+    */
+   void redraw ( void );
+
+   /*!
+    @function
+    @abstract   Sets the background refresh period.
+    @discussion Sets the time in which refresh rewrites the whole page shown
+    and the LCD configuration (@see refresh).
+
+    @param      period[in] refresh period in seconds, 0 disables the refresh.
+    */
+   void setRefreshPeriod ( uint16_t period );
+
+   /*!
+    @function
+    @abstract   Background refresh of the LCD.
+    @discussion Rewrites the LCD from the page shown a few cells at a time,
+    healing characters or settings garbled by ESD or noise that would
+    otherwise stay until the cell changes. Every refresh period all the cells
+    of the page and the LCD configuration (@see LCD::restoreConfig) are
+    rewritten on a rolling schedule: the characters written are those already
+    on display, there is no visible redraw.
+
+    To be called often from the main loop. Each call only rewrites the cells
+    that are due and that fit in the time budget, the time needed per cell is
+    measured on every call. Refresh moves the LCD cursor, it is not meant to
+    be used with a visible cursor.
+
+    @param      budget[in] maximum time in microseconds to spend in the call.
+    */
+   void refresh ( uint16_t budget );
+
+   /*!
+    @function
+    @abstract   Selects the page to write to.
+    @discussion Selects the page that receives the output of the setCursor,
+    clear and Print methods. Selecting a page doesn't change the page that is
+    displayed.
+
+    @param      page[in] page to write to (0 to numPages - 1).
+    */
+   void selectPage ( uint8_t page );
+
+   /*!
+    @function
+    @abstract   Page displayed.
+    @result     page shown on the LCD, LCD_NO_PAGE if none.
+    */
+   uint8_t shownPage ( void ) { return ( _shown ); };
+
+   /*!
+    @function
+    @abstract   Positions the cursor of the selected page.
+    @param      col[in] column.
+    @param      row[in] row.
+    */
+   void setCursor ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Clears the selected page.
+    @discussion Fills the selected page with blanks and positions its cursor
+    in the upper-left corner. If the page is being displayed only the
+    characters that were not blank are sent to the LCD.
+    */
+   void clear ( void );
+
+   /*!
+    @function
+    @abstract   Writes to the selected page.
+    @discussion Writes a character in the cursor position of the selected
+    page, characters written beyond the last column of a row are discarded.
+
+    @param      value[in] character to write.
+    */
+#if (ARDUINO <  100)
+   virtual void write ( uint8_t value );
+#else
+   virtual size_t write ( uint8_t value );
+#endif
+   using Print::write;
+
+private:
+   /*!
+    @function
+    @abstract   Updates a cell of the LCD.
+    @discussion Sends a character to the LCD positioning the LCD cursor only
+    if the previous write didn't leave it at the right position.
+
+    @param      cell[in] cell index (row * cols + col).
+    @param      value[in] character to write.
+    */
+   void sendCell ( uint16_t cell, uint8_t value );
+
+   LCD      &_lcd;        // LCD where the pages are shown
+   uint8_t  *_buffer;     // Storage for all the pages
+   uint8_t  _cols;        // Number of columns
+   uint8_t  _rows;        // Number of rows
+   uint8_t  _numPages;    // Number of pages
+   uint8_t  _shown;       // Page displayed on the LCD
+   uint8_t  _selected;    // Page receiving the output
+   uint8_t  _col;         // Cursor column of the selected page
+   uint8_t  _row;         // Cursor row of the selected page
+   uint16_t _lcdCursor;   // Cell where the LCD cursor is, 0xFFFF unknown
+   uint16_t _refreshPos;  // Next cell to refresh, cols * rows: LCD config
+   uint16_t _refreshStep; // Time between refreshes in ms, 0 disabled
+   unsigned long _refreshLast; // Time when the last refresh was due
+   uint16_t _refreshCost; // Measured time to refresh a cell (us)
+};
+
+#endif
@@ -0,0 +1,200 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDPort.cpp
+// This file implements the common 4 bit engine of the LCD drivers based on an
+// 8 bit output port (IO expanders, shift registers).
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LCDPort.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+/*!
+ @defined 
+ @abstract   LCD_NOBACKLIGHT
+ @discussion NO BACKLIGHT MASK
+ */
+#define LCD_NOBACKLIGHT 0x00
+
+/*!
+ @defined 
+ @abstract   LCD_BACKLIGHT
+ @discussion BACKLIGHT MASK used when backlight is on
+ */
+#define LCD_BACKLIGHT   0xFF
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDPort::LCDPort ( )
+{
+   mapPins ( 0, 0, 0, 0, 0, 0, 0 );
+   _polarity = POSITIVE;
+   _bulkLen  = 1;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// send
+void LCDPort::send ( uint8_t value, uint8_t mode )
+{
+   uint8_t burst[4];
+   uint8_t len = buildFrames ( value, mode, burst );
+   
+   if ( !portWrite ( burst, len ) )
+   {
+      transferError ();
+   }
+}
+
+//
+// setBacklightPin
+void LCDPort::setBacklightPin ( uint8_t value, t_backlighPol pol = POSITIVE )
+{
+   _backlightPinMask = ( 1 << value );
+   _backlightStsMask = LCD_NOBACKLIGHT;
+   _polarity = pol;
+   setBacklight ( BACKLIGHT_OFF );     // Set backlight to off as initial setup
+}
+
+//
+// setBacklight
+void LCDPort::setBacklight ( uint8_t value )
+{
+   // Check if backlight is available
+   // ----------------------------------------------------
+   if ( _backlightPinMask != 0x0 )
+   {
+      // Check for polarity to configure mask accordingly
+      // ----------------------------------------------------------
+      if  (((_polarity == POSITIVE) && (value > 0)) || 
+           ((_polarity == NEGATIVE ) && ( value == 0 )))
+      {
+         _backlightStsMask = _backlightPinMask & LCD_BACKLIGHT;
+      }
+      else 
+      {
+         _backlightStsMask = _backlightPinMask & LCD_NOBACKLIGHT;
+      }
+      if ( !deferBacklight () )
+      {
+         writeBacklight ();
+      }
+   }
+}
+
+// PROTECTED METHODS
+// ---------------------------------------------------------------------------
+
+//
+// mapPins
+void LCDPort::mapPins ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                        uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
+{
+   uint8_t dataPins[4];
+   
+   _En = ( 1 << En );
+   _Rw = ( 1 << Rw );
+   _Rs = ( 1 << Rs );
+   
+   _backlightPinMask = 0;
+   _backlightStsMask = LCD_NOBACKLIGHT;
+   
+   dataPins[0] = ( 1 << d4 );
+   dataPins[1] = ( 1 << d5 );
+   dataPins[2] = ( 1 << d6 );
+   dataPins[3] = ( 1 << d7 );
+   
+   // Port value of every nibble, sending a nibble is a table lookup
+   // --------------------------------------------------------------
+   for ( uint8_t value = 0; value < 16; value++ )
+   {
+      _nibble[value] = 0;
+      for ( uint8_t i = 0; i < 4; i++ )
+      {
+         if ( value & ( 1 << i ) )
+         {
+            _nibble[value] |= dataPins[i];
+         }
+      }
+   }
+}
+
+//
+// buildFrames
+uint8_t LCDPort::buildFrames ( uint8_t value, uint8_t mode, uint8_t *burst )
+{
+   uint8_t len = 0;
+   uint8_t control = _backlightStsMask;
+   
+   // Is it a command or data
+   // -----------------------
+   if ( mode == LCD_DATA )
+   {
+      control |= _Rs;
+   }
+   
+   // Each nibble is latched by the LCD on the falling edge of En
+   if ( mode != FOUR_BITS )
+   {
+      burst[len++] = _nibble[value >> 4] | control | _En;
+      burst[len++] = _nibble[value >> 4] | control;
+   }
+   burst[len++] = _nibble[value & 0x0F] | control | _En;
+   burst[len++] = _nibble[value & 0x0F] | control;
+   
+   return ( len );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// sendBulk
+void LCDPort::sendBulk ( const uint8_t *data, uint8_t len )
+{
+   uint8_t burst[LCDPORT_BULK * 4];
+   
+   while ( len > 0 )
+   {
+      uint8_t count = 0;
+      
+      for ( uint8_t i = 0; ( i < _bulkLen ) && ( len > 0 ); i++, len-- )
+      {
+         count += buildFrames ( *data++, LCD_DATA, &burst[count] );
+      }
+      if ( !portWrite ( burst, count ) )
+      {
+         transferError ();
+      }
+   }
+}
+
+//
+// writeBacklight
+void LCDPort::writeBacklight ( )
+{
+   portWrite ( &_backlightStsMask, 1 );
+}
@@ -0,0 +1,187 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDPort.h
+// This file implements the common 4 bit engine of the LCD drivers based on an
+// 8 bit output port (IO expanders, shift registers).
+//
+// @brief
+// Many LCD interfaces connect the LCD lines (D4-D7, RS, RW, EN and the
+// backlight) to the outputs of an 8 bit port: a PCF8574 I2C expander, a
+// 74HC595 shift register, ... The drivers only differ in how the port is
+// written. This class implements the rest once:
+//    - mapping of the LCD lines to the port bits, through a table built at
+//      configuration rather than a bit loop per nibble,
+//    - the enable pulses of a byte sent as a single burst of port values,
+//      that the transport can send in one bus transaction,
+//    - the strings printed sent in bursts of several characters, as many as
+//      the transport takes in one transaction (sendBulk),
+//    - the backlight control, including the deferred backlight changes.
+//
+// A driver derives from LCDPort, maps the pins with mapPins and implements
+// portWrite, the transport:
+//    class LiquidCrystal_XXX : public LCDPort
+//    {
+//       virtual bool portWrite ( const uint8_t *values, uint8_t len );
+//    };
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_PORT_H_
+#define _LCD_PORT_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Maximum number of characters per transfer of sendBulk.
+ @discussion 7 characters are 28 port values, they fit in the 32 byte buffer
+ of the Wire library.
+ */
+#ifndef LCDPORT_BULK
+#define LCDPORT_BULK   7
+#endif
+
+class LCDPort : public LCD
+{
+public:
+   /*!
+    @function
+    @abstract   Send a particular value to the LCD.
+    @discussion Sends a byte (or the low nibble with FOUR_BITS) to the LCD in
+    4 bit mode. The port values of all the enable pulses of the transfer are
+    handed to the transport in a single call.
+    
+    Users should never call this method.
+    
+    @param      value[in] Value to send to the LCD.
+    @param      mode[in] LCD_DATA - write to the LCD DDRAM or CGRAM, COMMAND -
+    write a command to the LCD, FOUR_BITS - write the low nibble as command.
+    */
+   virtual void send(uint8_t value, uint8_t mode);
+   
+   /*!
+    @function
+    @abstract   Sets the pin to control the backlight.
+    @discussion Sets the bit of the port that controls the backlight. The
+    backlight is switched off.
+    
+    @param      value[in] port bit of the backlight.
+    @param      pol[in] backlight polarity.
+    */
+   void setBacklightPin ( uint8_t value, t_backlighPol pol );
+   
+   /*!
+    @function
+    @abstract   Switch-on/off the LCD backlight.
+    @discussion The setBacklightPin has to be called before setting the
+    backlight for this method to work. This interface doesn't support dimming.
+    @see setBacklightPin, LCD::setBacklightLatency.
+    
+    @param      value[in] backlight mode (HIGH|LOW)
+    */
+   void setBacklight ( uint8_t value );
+   
+protected:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The lines are not mapped, the driver calls mapPins.
+    */
+   LCDPort ( );
+   
+   /*!
+    @function
+    @abstract   Maps the LCD lines to the bits of the port.
+    @discussion No backlight is configured, @see setBacklightPin.
+    
+    @param      En[in] port bit of the LCD En (Enable) line.
+    @param      Rw[in] port bit of the LCD Rw (Read/write) line.
+    @param      Rs[in] port bit of the LCD Rs (Register select) line.
+    @param      d4[in] port bit of the LCD data line 4.
+    @param      d5[in] port bit of the LCD data line 5.
+    @param      d6[in] port bit of the LCD data line 6.
+    @param      d7[in] port bit of the LCD data line 7.
+    */
+   void mapPins ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                  uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 );
+   
+   /*!
+    @function
+    @abstract   Port mask of a data line.
+    @param      line[in] data line, 0 (D4) to 3 (D7).
+    @result     port bit mask of the line.
+    */
+   uint8_t dataPin ( uint8_t line ) { return ( _nibble[1 << line] ); };
+   
+   /*!
+    @function
+    @abstract   Port values to send a value to the LCD.
+    @discussion Builds the En high/low port values of the nibbles of a
+    transfer, with the Rs line and the backlight state.
+    
+    @param      value[in] value to send.
+    @param      mode[in] LCD_DATA, COMMAND or FOUR_BITS.
+    @param      burst[out] port values, room for 4.
+    @result     number of port values.
+    */
+   virtual uint8_t buildFrames ( uint8_t value, uint8_t mode, uint8_t *burst );
+   
+   /*!
+    @function
+    @abstract   Writes values to the port.
+    @discussion The transport of the driver. Writes the values to the port in
+    order, each value has to be on the port outputs before the next one is
+    written. Transports that can, send all of them in a single transaction.
+    The values of a byte sent to the LCD are never split between calls, a
+    call carries up to 4 values, or up to 4 * _bulkLen values from sendBulk.
+    
+    @param      values[in] port values.
+    @param      len[in] number of values.
+    @result     true on success, false if the transfer failed.
+    */
+   virtual bool portWrite ( const uint8_t *values, uint8_t len ) = 0;
+   
+   uint8_t _En;               // Port bit mask of the En line
+   uint8_t _Rw;               // Port bit mask of the Rw line
+   uint8_t _Rs;               // Port bit mask of the Rs line
+   uint8_t _backlightPinMask; // Port bit mask of the backlight
+   uint8_t _backlightStsMask; // Backlight status mask
+   uint8_t _bulkLen;          // Characters per transfer of sendBulk, up to
+                              // LCDPORT_BULK
+   
+private:
+   /*!
+    @function
+    @abstract   Send data to the LCD.
+    @discussion Sends the characters in transfers of up to _bulkLen
+    characters. The transport paces the bytes, a driver only raises _bulkLen
+    if the port values of a byte take longer to write than the LCD takes to
+    execute the previous one, or if its portWrite waits for it.
+    @see LCD::sendBulk
+    */
+   virtual void sendBulk(const uint8_t *data, uint8_t len);
+   
+   /*!
+    @function
+    @abstract   Writes the backlight state.
+    @discussion Writes the port with the backlight state and all the LCD lines
+    low. @see LCD::setBacklightLatency.
+    */
+   virtual void writeBacklight();
+   
+   uint8_t _nibble[16];       // Port value of each nibble of the data lines
+};
+
+#endif
@@ -0,0 +1,237 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: Yes - any number of producers, a single consumer
+// Extendable: Yes
+//
+// @file LCDQueue.cpp
+// This file implements a thread safe front end for the LCD library.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include <inttypes.h>
+#include "LCDQueue.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+// Queued operations
+#define OP_PRINT       0
+#define OP_CLEAR       1
+#define OP_BACKLIGHT   2
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDQueue::LCDQueue ( LCD &lcd, t_lcdQueueSlot *slots, uint8_t numSlots ) :
+   _lcd ( lcd )
+{
+   _slots   = slots;
+   _mask    = numSlots - 1;
+   _tail    = 0;
+   _head    = 0;
+   _dropped = 0;
+
+   // A slot is free for position pos when its sequence number is pos
+   for ( uint8_t i = 0; i < numSlots; i++ )
+   {
+      _slots[i].seq = i;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// printAt
+bool LCDQueue::printAt ( uint8_t col, uint8_t row, const char *text )
+{
+   size_t  len   = strlen ( text );
+   uint8_t count = ( len + LCD_QUEUE_TEXT - 1 ) / LCD_QUEUE_TEXT;
+   uint16_t pos;
+
+   if ( count == 0 )
+   {
+      return ( true );
+   }
+
+   if ( !claim ( count, pos ) )
+   {
+      drop ();
+      return ( false );
+   }
+
+   for ( uint8_t i = 0; i < count; i++ )
+   {
+      t_lcdQueueSlot &slot = _slots[( pos + i ) & _mask];
+
+      slot.op  = OP_PRINT;
+      slot.col = col + ( i * LCD_QUEUE_TEXT );
+      slot.row = row;
+      slot.len = ( len > LCD_QUEUE_TEXT ) ? LCD_QUEUE_TEXT : len;
+      memcpy ( slot.text, text, slot.len );
+
+      text += slot.len;
+      len  -= slot.len;
+      publish ( pos + i );
+   }
+   return ( true );
+}
+
+//
+// clear
+bool LCDQueue::clear ( void )
+{
+   uint16_t pos;
+
+   if ( !claim ( 1, pos ) )
+   {
+      drop ();
+      return ( false );
+   }
+   _slots[pos & _mask].op = OP_CLEAR;
+   publish ( pos );
+   return ( true );
+}
+
+//
+// setBacklight
+bool LCDQueue::setBacklight ( uint8_t value )
+{
+   uint16_t pos;
+
+   if ( !claim ( 1, pos ) )
+   {
+      drop ();
+      return ( false );
+   }
+   _slots[pos & _mask].op  = OP_BACKLIGHT;
+   _slots[pos & _mask].col = value;
+   publish ( pos );
+   return ( true );
+}
+
+//
+// service
+uint8_t LCDQueue::service ( uint8_t maxOps )
+{
+   uint8_t done = 0;
+
+   while ( done < maxOps )
+   {
+      t_lcdQueueSlot &slot = _slots[_head & _mask];
+
+      // The slot is ready once the producer has published it
+      if ( __atomic_load_n ( &slot.seq, __ATOMIC_ACQUIRE ) !=
+           (uint16_t)( _head + 1 ) )
+      {
+         break;
+      }
+
+      switch ( slot.op )
+      {
+         case OP_PRINT:
+            _lcd.setCursor ( slot.col, slot.row );
+            _lcd.write ( (const uint8_t *)slot.text, slot.len );
+            break;
+         case OP_CLEAR:
+            _lcd.clear ();
+            break;
+         case OP_BACKLIGHT:
+            _lcd.setBacklight ( slot.col );
+            break;
+      }
+
+      // Release the slot for the next lap of the producers
+      __atomic_store_n ( &slot.seq, (uint16_t)( _head + _mask + 1 ),
+                         __ATOMIC_RELEASE );
+      _head++;
+      done++;
+   }
+   return ( done );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// claim
+bool LCDQueue::claim ( uint8_t count, uint16_t &pos )
+{
+   pos = __atomic_load_n ( &_tail, __ATOMIC_RELAXED );
+
+   if ( count > _mask + 1 )
+   {
+      return ( false );
+   }
+
+   for ( ;; )
+   {
+      bool   moved = false;
+
+      for ( uint8_t i = 0; i < count; i++ )
+      {
+         uint16_t seq = __atomic_load_n ( &_slots[( pos + i ) & _mask].seq,
+                                          __ATOMIC_ACQUIRE );
+         int16_t  diff = (int16_t)( seq - (uint16_t)( pos + i ) );
+
+         if ( diff < 0 )
+         {
+            // The consumer hasn't released the slot yet, the queue is full
+            return ( false );
+         }
+         if ( diff > 0 )
+         {
+            // Another producer has claimed the slot
+            moved = true;
+            break;
+         }
+      }
+
+      if ( moved )
+      {
+         pos = __atomic_load_n ( &_tail, __ATOMIC_RELAXED );
+      }
+      else if ( __atomic_compare_exchange_n ( &_tail, &pos,
+                                              (uint16_t)( pos + count ), true,
+                                              __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED ) )
+      {
+         return ( true );
+      }
+      // On a failed compare and swap pos holds the current tail
+   }
+}
+
+//
+// publish
+void LCDQueue::publish ( uint16_t pos )
+{
+   __atomic_store_n ( &_slots[pos & _mask].seq, (uint16_t)( pos + 1 ),
+                      __ATOMIC_RELEASE );
+}
+
+//
+// drop
+void LCDQueue::drop ( void )
+{
+   uint16_t count = __atomic_load_n ( &_dropped, __ATOMIC_RELAXED );
+
+   while ( ( count < 0xFFFF ) &&
+           !__atomic_compare_exchange_n ( &_dropped, &count, count + 1, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED ) );
+}
@@ -0,0 +1,177 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: Yes - any number of producers, a single consumer
+// Extendable: Yes
+//
+// @file LCDQueue.h
+// This file implements a thread safe front end for the LCD library.
+//
+// @brief
+// On multitasking platforms (ESP32/FreeRTOS, ...) several tasks may need to
+// draw on the same LCD. Rather than serialising them with a mutex held for
+// the whole bus transfer, the tasks (producers) post drawing operations into
+// a lock-free queue and return immediately. A single task (the consumer)
+// calls service() to execute the operations queued on the LCD, it is the
+// only one accessing the LCD.
+//
+// Each operation is self contained (printAt carries its position), the
+// output of a producer can't be split by the operations of another one.
+//
+// The queue is a bounded multi-producer single-consumer ring: producers
+// claim a slot with a compare and swap on the tail index and publish it with
+// a per slot sequence number, the consumer needs no atomic read-modify-write
+// operation. If the queue is full the operation is dropped and counted, a
+// producer never blocks. The atomic operations are the GCC __atomic
+// builtins, available on all the Arduino cores.
+//
+// The positions and sequence numbers are 16 bit counters, compared modulo
+// 65536: a producer interrupted between reading the tail and claiming it
+// would only be fooled if the queue went through 65536 positions meanwhile.
+//
+// The slot storage is provided by the application, its size must be a power
+// of 2 up to 128 slots:
+//    t_lcdQueueSlot slots[16];
+//    LCDQueue queue(lcd, slots, 16);
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_QUEUE_H_
+#define _LCD_QUEUE_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Maximum text of a queued operation.
+ @discussion Number of characters carried by a printAt operation, longer
+ texts are queued as several operations.
+ */
+#ifndef LCD_QUEUE_TEXT
+#define LCD_QUEUE_TEXT    20
+#endif
+
+/*!
+ @typedef
+ @abstract   Queue slot.
+ @discussion Storage of a queued drawing operation. Only to be used to
+ declare the storage of the queue.
+ */
+typedef struct
+{
+   uint16_t seq;                  // Slot sequence number
+   uint8_t op;                    // Operation
+   uint8_t col;                   // Column or operation argument
+   uint8_t row;                   // Row
+   uint8_t len;                   // Length of the text
+   char    text[LCD_QUEUE_TEXT];  // Text to print
+} t_lcdQueueSlot;
+
+class LCDQueue
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Creates an empty queue for an LCD. The LCD has to be
+    initialised (begin) before calling service.
+
+    @param      lcd[in] LCD on which the operations are executed.
+    @param      slots[in] queue storage.
+    @param      numSlots[in] number of slots, a power of 2 up to 128.
+    */
+   LCDQueue ( LCD &lcd, t_lcdQueueSlot *slots, uint8_t numSlots );
+
+   /*!
+    @function
+    @abstract   Queues a print operation.
+    @discussion Queues the printing of a text at a given position. Texts longer
+    than LCD_QUEUE_TEXT take several slots, they are queued only if all of
+    them are available.
+
+    Can be called from any task.
+
+    @param      col[in] column where the text starts.
+    @param      row[in] row where the text is printed.
+    @param      text[in] text to print.
+    @result     true if queued, false if the queue is full.
+    */
+   bool printAt ( uint8_t col, uint8_t row, const char *text );
+
+   /*!
+    @function
+    @abstract   Queues a clear operation.
+    @discussion Can be called from any task. @see LCD::clear
+    @result     true if queued, false if the queue is full.
+    */
+   bool clear ( void );
+
+   /*!
+    @function
+    @abstract   Queues a backlight operation.
+    @discussion Can be called from any task. @see LCD::setBacklight
+    @param      value[in] backlight value.
+    @result     true if queued, false if the queue is full.
+    */
+   bool setBacklight ( uint8_t value );
+
+   /*!
+    @function
+    @abstract   Executes the queued operations.
+    @discussion Executes on the LCD the operations in the queue in the order
+    they were queued. Must always be called from the same task.
+
+    @param      maxOps[in] maximum number of operations to execute.
+    @result     number of operations executed.
+    */
+   uint8_t service ( uint8_t maxOps = 0xFF );
+
+   /*!
+    @function
+    @abstract   Operations dropped.
+    @result     number of operations dropped because the queue was full
+    (saturates at 65535).
+    */
+   uint16_t dropped ( void ) { return ( __atomic_load_n ( &_dropped,
+                                                          __ATOMIC_RELAXED ) ); };
+
+private:
+   /*!
+    @function
+    @abstract   Claims consecutive slots of the queue.
+    @param      count[in] number of slots needed.
+    @param      pos[out] position of the first slot claimed.
+    @result     true if the slots were claimed, false if the queue is full.
+    */
+   bool claim ( uint8_t count, uint16_t &pos );
+
+   /*!
+    @function
+    @abstract   Publishes a slot to the consumer.
+    @param      pos[in] position of the slot.
+    */
+   void publish ( uint16_t pos );
+
+   /*!
+    @function
+    @abstract   Counts an operation dropped.
+    */
+   void drop ( void );
+
+   LCD            &_lcd;      // LCD where the operations are executed
+   t_lcdQueueSlot *_slots;    // Queue storage
+   uint8_t        _mask;      // Number of slots - 1
+   uint16_t       _tail;      // Next position to claim (producers)
+   uint16_t       _head;      // Next position to execute (consumer)
+   uint16_t       _dropped;   // Operations dropped
+};
+
+#endif
@@ -0,0 +1,92 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDSparkline.cpp
+// This file implements a scrolling trend graph (sparkline) for the LCD
+// library.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LCDSparkline.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDSparkline::LCDSparkline ( LCD &lcd, uint8_t cells, int16_t min, int16_t max,
+                             uint8_t location ) :
+   _canvas ( lcd, cells, 1, location )
+{
+   // The range is never empty, at the top of int16_t it extends downwards
+   _min  = min;
+   _max  = max;
+   if ( max <= min )
+   {
+      if ( min < 0x7FFF )
+      {
+         _max = min + 1;
+      }
+      else
+      {
+         _min = min - 1;
+      }
+   }
+   _bars = true;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// add
+uint8_t LCDSparkline::add ( int16_t value )
+{
+   uint8_t x     = _canvas.width () - 1;
+   int32_t range = (int32_t)_max - (int32_t)_min;
+   uint8_t y;
+
+   if ( value < _min )
+   {
+      value = _min;
+   }
+   if ( value > _max )
+   {
+      value = _max;
+   }
+
+   // Row of the sample, the top row is the maximum. The differences are
+   // computed in 32 bits, they don't fit in an int16_t (int on AVR).
+   y = ( LCD_CHAR_HEIGHT - 1 ) -
+       ( ( ( (int32_t)value - (int32_t)_min ) * ( LCD_CHAR_HEIGHT - 1 ) +
+           ( range / 2 ) ) / range );
+
+   _canvas.scrollLeft ();
+   _canvas.vLine ( x, y, _bars ? LCD_CHAR_HEIGHT - 1 : y );
+
+   return ( _canvas.flush () );
+}
+
+//
+// clear
+uint8_t LCDSparkline::clear ( void )
+{
+   _canvas.clear ();
+   return ( _canvas.flush () );
+}
@@ -0,0 +1,111 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDSparkline.h
+// This file implements a scrolling trend graph (sparkline) for the LCD
+// library.
+//
+// @brief
+// The sparkline plots the recent history of a value on a row of custom
+// characters, one pixel column per sample: a sparkline of 4 characters shows
+// the last 20 samples. Each new sample scrolls the graph one pixel to the
+// left.
+//
+// The graph is kept in an LCDCanvas. Scrolling shifts the pixel columns of
+// the glyphs in RAM and only the glyph rows whose bits change are uploaded,
+// the cost of a sample is bounded by the 8 rows of each character and is
+// usually much lower on slow moving values. The text on the rest of the LCD
+// is not affected.
+//
+//    LCDSparkline trend(lcd, 4, 0, 100);
+//    trend.place(12, 0);
+//    ...
+//    trend.add(temperature);
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _LCD_SPARKLINE_H_
+#define _LCD_SPARKLINE_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+#include "LCDCanvas.h"
+
+class LCDSparkline
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Creates an empty sparkline of "cells" characters. The
+    characters use the CGRAM locations from "location" onwards.
+
+    @param      lcd[in] LCD where the sparkline is displayed.
+    @param      cells[in] width of the sparkline in characters (1 to 8).
+    @param      min[in] value plotted at the bottom of the graph.
+    @param      max[in] value plotted at the top of the graph.
+    @param      location[in] first CGRAM location used, location + cells must
+    not exceed 8.
+    */
+   LCDSparkline ( LCD &lcd, uint8_t cells, int16_t min, int16_t max,
+                  uint8_t location = 0 );
+
+   /*!
+    @function
+    @abstract   Displays the sparkline.
+    @discussion Writes the characters of the sparkline on the LCD.
+    @see LCDCanvas::place
+
+    @param      col[in] LCD column of the first character.
+    @param      row[in] LCD row.
+    */
+   void place ( uint8_t col, uint8_t row ) { _canvas.place ( col, row ); };
+
+   /*!
+    @function
+    @abstract   Selects the plot style.
+    @discussion Bars fill the column from the bottom up to the sample, a line
+    only lights the pixel of the sample. Applies to the samples added from
+    then on.
+
+    @param      bars[in] true for bars (default), false for a line.
+    */
+   void setBars ( bool bars ) { _bars = bars; };
+
+   /*!
+    @function
+    @abstract   Appends a sample.
+    @discussion Scrolls the graph one pixel to the left, plots the sample on
+    the rightmost column and uploads the glyph rows that changed. Values
+    outside the min..max range are clipped.
+
+    @param      value[in] sample to plot.
+    @result     number of glyph rows uploaded.
+    */
+   uint8_t add ( int16_t value );
+
+   /*!
+    @function
+    @abstract   Clears the history.
+    @result     number of glyph rows uploaded.
+    */
+   uint8_t clear ( void );
+
+private:
+   LCDCanvas _canvas;       // Glyphs of the graph
+   int16_t   _min;          // Value at the bottom of the graph
+   int16_t   _max;          // Value at the top of the graph
+   bool      _bars;         // Plot style
+};
+
+#endif
@@ -121,6 +121,8 @@ LiquidCrystal::LiquidCrystal(uint8_t rs, uint8_t enable,
 // send
 void LiquidCrystal::send(uint8_t value, uint8_t mode) 
 {
+   busyWait ();
+   
    // Only interested in COMMAND or DATA
    digitalWrite( _rs_pin, ( mode == LCD_DATA ) );
    
@@ -147,7 +149,52 @@ void LiquidCrystal::send(uint8_t value, uint8_t mode)
    {
       writeNbits ( value, 4 );
    }
-   waitUsec ( EXEC_TIME ); // wait for the command to execute by the LCD
+   execWait (); // wait for the command to execute by the LCD
+}
+
+//
+// recv
+int LiquidCrystal::recv(uint8_t mode)
+{
+   uint8_t value;
+   uint8_t numBits = ( _displayfunction & LCD_8BITMODE ) ? 8 : 4;
+   
+   // Reading needs the RW line
+   // -------------------------
+   if (_rw_pin == 255)
+   {
+      return ( -1 );
+   }
+   
+   busyWait ();
+   
+   // Release the data lines and set the LCD in read mode
+   // ---------------------------------------------------
+   for ( uint8_t i = 0; i < numBits; i++ )
+   {
+      pinMode ( _data_pins[i], INPUT );
+   }
+   digitalWrite( _rs_pin, ( mode == LCD_DATA ) );
+   digitalWrite( _rw_pin, HIGH );
+   
+   if ( numBits == 8 )
+   {
+      value = readNbits ( 8 );
+   }
+   else
+   {
+      value = readNbits ( 4 ) << 4;
+      value |= readNbits ( 4 );
+   }
+   
+   digitalWrite( _rw_pin, LOW );
+   for ( uint8_t i = 0; i < numBits; i++ )
+   {
+      pinMode ( _data_pins[i], OUTPUT );
+   }
+   execWait (); // reading data also updates the address counter
+   
+   return ( value );
 }
 
 //
@@ -227,6 +274,9 @@ void LiquidCrystal::init(uint8_t fourbitmode, uint8_t rs, uint8_t rw, uint8_t en
    _rw_pin = rw;
    _enable_pin = enable;
    
+   // A busy flag read takes about the execution time of an instruction
+   _pollCost = ( rw != 255 ) ? 2 * EXEC_TIME : 0;
+   
    _data_pins[0] = d0;
    _data_pins[1] = d1;
    _data_pins[2] = d2;
@@ -307,3 +357,22 @@ void LiquidCrystal::writeNbits(uint8_t value, uint8_t numBits)
    pulseEnable();
 }
 
+//
+// readNbits
+uint8_t LiquidCrystal::readNbits(uint8_t numBits) 
+{
+   uint8_t value = 0;
+   
+   digitalWrite(_enable_pin, HIGH);
+   waitUsec(1);          // data is valid 160ns after enable rises
+   for (uint8_t i = 0; i < numBits; i++) 
+   {
+      if ( digitalRead(_data_pins[i]) == HIGH )
+      {
+         value |= ( 1 << i );
+      }
+   }
+   digitalWrite(_enable_pin, LOW);
+   
+   return ( value );
+}
@@ -98,6 +98,21 @@ public:
     */
    virtual void send(uint8_t value, uint8_t mode);
    
+   /*!
+    @function
+    @abstract   Receive a value from the LCD.
+    @discussion Reads the busy flag and address counter or the data at the
+    current address of the LCD. Reading is only available if the RW pin of
+    the LCD has been assigned in the constructor.
+    
+    Users should never call this method.
+    
+    @param      mode[in] COMMAND - busy flag and address counter, LCD_DATA - 
+    data at the current address.
+    @result     value read, -1 if there is no RW pin.
+    */
+   virtual int recv(uint8_t mode);
+   
    /*!
     @function
     @abstract   Sets the pin to control the backlight.
@@ -124,6 +139,24 @@ public:
     */
    void setBacklight ( uint8_t value );
    
+protected:
+   /*!
+    @method     
+    @abstract   Waits for the LCD to be ready for a transfer.
+    @discussion Called before every transfer to the LCD. The LCD is always
+    ready since execWait waits for the previous command to complete.
+    */
+   virtual void busyWait() { };
+   
+   /*!
+    @method     
+    @abstract   Waits for the LCD to execute a transfer.
+    @discussion Called after every transfer to the LCD, waits for the
+    execution time of the command. Drivers that can do useful work while the
+    LCD is busy redefine it together with busyWait.
+    */
+   virtual void execWait() { waitUsec ( EXEC_TIME ); };
+   
 private:
    
    /*!
@@ -143,6 +176,14 @@ private:
     */   
    void writeNbits(uint8_t value, uint8_t numBits);
    
+   /*!
+    @method     
+    @abstract   Reads numBits bits from the LCD.
+    @discussion Reads numBits bits from the LCD data lines with an enable
+    pulse. The data lines have to be configured as inputs and RW high.
+    */   
+   uint8_t readNbits(uint8_t numBits);
+   
    /*!
     @method     
     @abstract   Pulse the LCD enable line (En).
@@ -39,22 +39,6 @@
 // CONSTANT  definitions
 // ---------------------------------------------------------------------------
 
-// flags for backlight control
-/*!
- @defined 
- @abstract   LCD_NOBACKLIGHT
- @discussion NO BACKLIGHT MASK
- */
-#define LCD_NOBACKLIGHT 0x00
-
-/*!
- @defined 
- @abstract   LCD_BACKLIGHT
- @discussion BACKLIGHT MASK used when backlight is on
- */
-#define LCD_BACKLIGHT   0xFF
-
-
 // Default library configuration parameters used by class constructor with
 // only the I2C address field.
 // ---------------------------------------------------------------------------
@@ -148,41 +132,58 @@ void LiquidCrystal_I2C::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
    LCD::begin ( cols, lines, dotsize );   
 }
 
+//
+// startInterface
+void LiquidCrystal_I2C::startInterface() 
+{
+   init();     // Initialise the I2C expander interface
+}
+
+//
+// beginWarm
+void LiquidCrystal_I2C::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize) 
+{
+   init();     // Initialise the I2C expander interface
+   LCD::beginWarm ( cols, lines, dotsize );   
+}
+
 
 // User commands - users can expand this section
 //----------------------------------------------------------------------------
 // Turn the (optional) backlight off/on
 
 //
-// setBacklightPin
-void LiquidCrystal_I2C::setBacklightPin ( uint8_t value, t_backlighPol pol = POSITIVE )
+// setInputPins
+void LiquidCrystal_I2C::setInputPins ( uint8_t mask, uint16_t period )
 {
-   _backlightPinMask = ( 1 << value );
-   _polarity = pol;
-   setBacklight(BACKLIGHT_OFF);
+   _inputMask    = mask;
+   _samplePeriod = period;
+   
+   for ( uint8_t pin = 0; pin < 8; pin++ )
+   {
+      _i2cio.pinMode ( pin, ( mask & ( 1 << pin ) ) ? INPUT : OUTPUT );
+   }
+   _sampledAt = millis () - period;
 }
 
 //
-// setBacklight
-void LiquidCrystal_I2C::setBacklight( uint8_t value ) 
+// readInputs
+uint8_t LiquidCrystal_I2C::readInputs ( void )
 {
-   // Check if backlight is available
-   // ----------------------------------------------------
-   if ( _backlightPinMask != 0x0 )
+   if ( sampleDue () )
    {
-      // Check for polarity to configure mask accordingly
-      // ----------------------------------------------------------
-      if  (((_polarity == POSITIVE) && (value > 0)) || 
-           ((_polarity == NEGATIVE ) && ( value == 0 )))
-      {
-         _backlightStsMask = _backlightPinMask & LCD_BACKLIGHT;
-      }
-      else 
-      {
-         _backlightStsMask = _backlightPinMask & LCD_NOBACKLIGHT;
-      }
-      _i2cio.write( _backlightStsMask );
+      _i2cio.read ();
+      _sampledAt = millis ();
    }
+   return ( _i2cio.readCached () & _inputMask );
+}
+
+//
+// setAddressStore
+void LiquidCrystal_I2C::setAddressStore ( t_i2cAddrLoad load, t_i2cAddrSave save )
+{
+   _addrLoad = load;
+   _addrSave = save;
 }
 
 
@@ -195,12 +196,23 @@ int LiquidCrystal_I2C::init()
 {
    int status = 0;
    
+   _i2cio.flush ();  // Detection uses Wire
+   
+   if ( _autoAddr )
+   {
+      detectAddress ();
+   }
+   
    // initialize the backpack IO expander
    // and display functions.
    // ------------------------------------------------------------------------
-   if ( _i2cio.begin ( _Addr ) == 1 )
+   if ( ( _Addr != I2C_ADDR_AUTO ) && ( _i2cio.begin ( _Addr ) == 1 ) )
    {
       _i2cio.portMode ( OUTPUT );  // Set the entire IO extender to OUTPUT
+      if ( _inputMask != 0 )
+      {
+         setInputPins ( _inputMask, _samplePeriod );
+      }
       _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
       status = 1;
       _i2cio.write(0);  // Set the entire port to LOW
@@ -208,26 +220,52 @@ int LiquidCrystal_I2C::init()
    return ( status );
 }
 
+//
+// detectAddress
+void LiquidCrystal_I2C::detectAddress ()
+{
+   uint8_t hint = _Addr;
+   
+   // Once detected, the address is kept for the next initialisations
+   if ( ( hint == I2C_ADDR_AUTO ) && ( _addrLoad != NULL ) )
+   {
+      hint = _addrLoad ();
+   }
+   
+   _Addr = I2CIO::detect ( hint );
+   
+   if ( ( _Addr != I2C_ADDR_AUTO ) && ( _Addr != hint ) &&
+        ( _addrSave != NULL ) )
+   {
+      _addrSave ( _Addr );
+   }
+}
+
+//
+// sampleDue
+bool LiquidCrystal_I2C::sampleDue ()
+{
+   return ( ( _inputMask != 0 ) && ( millis () - _sampledAt >= _samplePeriod ) );
+}
+
 //
 // config
 void LiquidCrystal_I2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8_t Rs, 
                                 uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
 {
    _Addr = lcd_Addr;
+   _autoAddr = ( lcd_Addr == I2C_ADDR_AUTO );
+   _addrLoad = NULL;
+   _addrSave = NULL;
+   _inputMask = 0;
+   _samplePeriod = 0;
+   _sampledAt = 0;
    
-   _backlightPinMask = 0;
-   _backlightStsMask = LCD_NOBACKLIGHT;
-   _polarity = POSITIVE;
-   
-   _En = ( 1 << En );
-   _Rw = ( 1 << Rw );
-   _Rs = ( 1 << Rs );
+   mapPins ( En, Rw, Rs, d4, d5, d6, d7 );
    
-   // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );   
+   // Up to 400kHz the 2 port values between the enable pulses of two bytes
+   // take longer than the LCD execution time, a string can be streamed
+   _bulkLen = LCDPORT_BULK;
 }
 
 
@@ -238,54 +276,95 @@ void LiquidCrystal_I2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8_
 //
 // send - write either command or data
 void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) 
+{
+   LCDPort::send ( value, mode );
+   
+   // The LCD library times these from their return, they can't be left in
+   // the queue of a non blocking transport
+   if ( ( mode == FOUR_BITS ) || 
+        ( ( mode == COMMAND ) && ( value <= ( LCD_RETURNHOME | 1 ) ) ) )
+   {
+      _i2cio.flush ();
+   }
+}
+
+//
+// recv - read busy flag and address or data
+int LiquidCrystal_I2C::recv(uint8_t mode) 
+{
+   uint8_t control = _Rw | _backlightStsMask;
+   uint8_t value;
+   
+   if ( mode == LCD_DATA )
+   {
+      control |= _Rs;
+   }
+   
+   dataLinesMode ( INPUT );
+   value = read4bits ( control ) << 4;
+   value |= read4bits ( control );
+   dataLinesMode ( OUTPUT );
+   
+   _i2cio.write ( _backlightStsMask );  // RW back to write
+   
+   return ( value );
+}
+
+//
+// portWrite
+bool LiquidCrystal_I2C::portWrite (const uint8_t *values, uint8_t len)
 {
    // No need to use the delay routines since the time taken to write takes
    // longer that what is needed both for toggling and enable pin an to execute
    // the command.
+   bool sample = sampleDue ();
    
-   if ( mode == FOUR_BITS )
+   if ( !_i2cio.write ( values, len, sample ) )
    {
-      write4bits( (value & 0x0F), COMMAND );
+      return ( false );
    }
-   else 
+   if ( sample )
    {
-      write4bits( (value >> 4), mode );
-      write4bits( (value & 0x0F), mode);
+      _sampledAt = millis ();
    }
+   return ( true );
 }
 
 //
-// write4bits
-void LiquidCrystal_I2C::write4bits ( uint8_t value, uint8_t mode ) 
+// read4bits
+uint8_t LiquidCrystal_I2C::read4bits (uint8_t control)
 {
-   uint8_t pinMapValue = 0;
+   uint8_t port;
+   uint8_t value = 0;
    
-   // Map the value to LCD pin mapping
-   // --------------------------------
+   _i2cio.write (control | _En);    // En HIGH, the LCD drives the data lines
+   port = _i2cio.read ();
+   _i2cio.write (control & ~_En);   // En LOW
+   
+   // Map the LCD pin mapping to the value
+   // ------------------------------------
    for ( uint8_t i = 0; i < 4; i++ )
    {
-      if ( ( value & 0x1 ) == 1 )
+      if ( port & dataPin ( i ) )
       {
-         pinMapValue |= _data_pins[i];
+         value |= ( 1 << i );
       }
-      value = ( value >> 1 );
-   }
-   
-   // Is it a command or data
-   // -----------------------
-   if ( mode == LCD_DATA )
-   {
-      mode = _Rs;
    }
-   
-   pinMapValue |= mode | _backlightStsMask;
-   pulseEnable ( pinMapValue );
+   return ( value );
 }
 
 //
-// pulseEnable
-void LiquidCrystal_I2C::pulseEnable (uint8_t data)
+// dataLinesMode
+void LiquidCrystal_I2C::dataLinesMode (uint8_t dir)
 {
-   _i2cio.write (data | _En);   // En HIGH
-   _i2cio.write (data & ~_En);  // En LOW
-}
\ No newline at end of file
+   uint8_t dataMask = dataPin ( 0 ) | dataPin ( 1 ) | dataPin ( 2 ) | 
+                      dataPin ( 3 );
+   
+   for ( uint8_t pin = 0; pin < 8; pin++ )
+   {
+      if ( dataMask & ( 1 << pin ) )
+      {
+         _i2cio.pinMode ( pin, dir );
+      }
+   }
+}
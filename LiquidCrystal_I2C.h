@@ -32,10 +32,10 @@
 #include <Print.h>
 
 #include "I2CIO.h"
-#include "LCD.h"
+#include "LCDPort.h"
 
 
-class LiquidCrystal_I2C : public LCD 
+class LiquidCrystal_I2C : public LCDPort
 {
 public:
    
@@ -109,43 +109,124 @@ public:
     */
    virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);   
    
+   /*!
+    @function
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the I2C expander and attaches to an LCD that has
+    kept its configuration and contents while the MCU was reset. 
+    @see LCD::beginWarm.
+    
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows, 
+                          uint8_t charsize = LCD_5x8DOTS);
+   
+   /*!
+    @function
+    @abstract   Receive a value from the LCD.
+    @discussion Reads the busy flag and address counter or the data at the
+    current address of the LCD. The LCD RW line has to be wired to the IO
+    expander, otherwise the values read are meaningless.
+    
+    A read takes 7 I2C transactions (about 2ms at 100kHz), longer than the
+    LCD instructions: the driver doesn't poll the busy flag, the LCD waits
+    are fixed delays.
+    
+    Users should never call this method.
+    
+    @param      mode[in] COMMAND - busy flag and address counter, LCD_DATA - 
+    data at the current address.
+    @result     value read.
+    */
+   virtual int recv(uint8_t mode);
+   
    /*!
     @function
     @abstract   Send a particular value to the LCD.
-    @discussion Sends a particular value to the LCD for writing to the LCD or
-    as an LCD command.
+    @discussion Writes the value through the IO expander. With a non blocking
+    transport, the instructions the LCD library waits for (clear, home and
+    the initialisation) are sent before returning. @see setTransport
     
     Users should never call this method.
     
     @param      value[in] Value to send to the LCD.
-    @param      mode[in] DATA - write to the LCD CGRAM, COMMAND - write a 
-    command to the LCD.
+    @param      mode[in] LCD_DATA - write to the LCD DDRAM or CGRAM, COMMAND -
+    write a command to the LCD, FOUR_BITS - write the low nibble as command.
     */
    virtual void send(uint8_t value, uint8_t mode);
    
    /*!
     @function
-    @abstract   Sets the pin to control the backlight.
-    @discussion Sets the pin in the device to control the backlight. This device
-    doesn't support dimming backlight capability.
+    @abstract   Configures spare pins of the expander as inputs.
+    @discussion Boards with buttons or switches on pins of the expander not
+    used by the LCD can read them without extra bus transactions: the inputs
+    are sampled, at most every "period" milliseconds, in the same bus session
+    as the LCD output. @see readInputs
+    
+    @param      mask[in] expander pins used as inputs (bit n: pin n).
+    @param      period[in] minimum time between samples in milliseconds.
+    */
+   void setInputPins ( uint8_t mask, uint16_t period );
+   
+   /*!
+    @function
+    @abstract   Reads the input pins.
+    @discussion Returns the inputs sampled with the LCD output. Only if they
+    are older than the sampling period (no LCD output lately) the expander is
+    read.
+    
+    @result     value of the input pins (bit n: pin n).
+    */
+   uint8_t readInputs ( void );
+   
+   /*!
+    @function
+    @abstract   Sets the storage of the detected I2C address.
+    @discussion When the driver is created with I2C_ADDR_AUTO as address, the
+    address of the backpack is detected on initialisation (begin). The last
+    address found is probed first and the bus is only scanned if the backpack
+    doesn't answer there, the new address is then saved. A typical store is
+    a byte of the EEPROM.
     
-    @param      0: backlight off, 1..255: backlight on.
+    @param      load[in] function returning the last address saved.
+    @param      save[in] function saving the address detected.
+    */
+   void setAddressStore ( t_i2cAddrLoad load, t_i2cAddrSave save );
+   
+   /*!
+    @function
+    @abstract   I2C address of the backpack.
+    @result     address in use, I2C_ADDR_AUTO if it has not been detected.
     */
-   void setBacklightPin ( uint8_t value, t_backlighPol pol );
+   uint8_t getAddress ( void ) { return ( _Addr ); };
    
+#if defined (TWCR)
    /*!
     @function
-    @abstract   Switch-on/off the LCD backlight.
-    @discussion Switch-on/off the LCD backlight.
-    The setBacklightPin has to be called before setting the backlight for
-    this method to work. @see setBacklightPin.
+    @abstract   Sends the LCD output in the background.
+    @discussion The LCD output is queued in the transport and sent by the TWI
+    hardware while the program continues, loop has to call the service method
+    of the transport. The transfer errors are reported to the LCD with the
+    next output. Reading the LCD (busy flag) and sampling the inputs wait for
+    the queue to be sent. @see TWIIO
     
-    @param      value: backlight mode (HIGH|LOW)
+    @param      twi[in] transport, NULL to return to blocking writes.
     */
-   void setBacklight ( uint8_t value );
+   void setTransport ( TWIIO *twi ) { _i2cio.setTransport ( twi ); };
+#endif
    
 private:
    
+   /*!
+    @method     
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the I2C interface, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+   
    /*!
     @method     
     @abstract   Initializes the LCD class
@@ -173,31 +254,52 @@ private:
    
    /*!
     @method     
-    @abstract   Writes an 4 bit value to the LCD.
-    @discussion Writes 4 bits (the least significant) to the LCD control data lines.
-    @param      value[in] Value to write to the LCD
-    @param      more[in]  Value to distinguish between command and data.
-    COMMAND == command, DATA == data.
+    @abstract   Detects the I2C address of the backpack.
+    @discussion Probes the current or last saved address and scans the bus if
+    the backpack is not there. @see setAddressStore
+    */
+   void detectAddress ();
+   
+   /*!
+    @method     
+    @abstract   Writes values to the IO expander.
+    @discussion All the values are written in a single I2C transaction, the
+    inputs are sampled in the same bus session when due. @see LCDPort::portWrite
+    */
+   virtual bool portWrite(const uint8_t *values, uint8_t len);
+   
+   /*!
+    @method     
+    @abstract   Reads a nibble from the LCD.
+    @discussion Raises the LCD enable line, samples the data lines and lowers
+    the enable line. The data lines of the expander have to be set as inputs.
+    @param      control[in] RS, RW and backlight lines to use during the read.
+    */
+   uint8_t read4bits(uint8_t control);
+   
+   /*!
+    @method     
+    @abstract   Sets the direction of the LCD data lines on the expander.
+    @param      dir[in] INPUT to read from the LCD, OUTPUT to write to it.
     */
-   void write4bits(uint8_t value, uint8_t mode);
+   void dataLinesMode(uint8_t dir);
    
    /*!
     @method     
-    @abstract   Pulse the LCD enable line (En).
-    @discussion Sends a pulse of 1 uS to the Enable pin to execute an command
-    or write operation.
+    @abstract   Checks if the inputs have to be sampled.
+    @result     true if the sampling period has elapsed.
     */
-   void pulseEnable(uint8_t);
+   bool sampleDue();
    
    
    uint8_t _Addr;             // I2C Address of the IO expander
-   uint8_t _backlightPinMask; // Backlight IO pin mask
-   uint8_t _backlightStsMask; // Backlight status mask
+   bool    _autoAddr;         // Detect the I2C address on initialisation
+   t_i2cAddrLoad _addrLoad;   // Storage of the detected address
+   t_i2cAddrSave _addrSave;
+   uint8_t _inputMask;        // Expander pins used as inputs
+   uint16_t _samplePeriod;    // Input sampling period (ms)
+   unsigned long _sampledAt;  // Time of the last input sample
    I2CIO   _i2cio;            // I2CIO PCF8574* expansion module driver I2CLCDextraIO
-   uint8_t _En;               // LCD expander word for enable pin
-   uint8_t _Rw;               // LCD expander word for R/W pin
-   uint8_t _Rs;               // LCD expander word for Register Select pin
-   uint8_t _data_pins[4];     // LCD data lines
    
 };
 
@@ -52,6 +52,21 @@ void LiquidCrystal_I2C_ByVac::begin(uint8_t cols, uint8_t lines, uint8_t dotsize
    LCD::begin ( cols, lines, dotsize );   
 }
 
+//
+// startInterface
+void LiquidCrystal_I2C_ByVac::startInterface() 
+{
+   Wire.begin();
+}
+
+//
+// beginWarm
+void LiquidCrystal_I2C_ByVac::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize) 
+{
+   Wire.begin();
+   LCD::beginWarm ( cols, lines, dotsize );   
+}
+
 // User commands - users can expand this section
 //----------------------------------------------------------------------------
 // Turn the integrated backlight off/on
@@ -101,5 +116,8 @@ void LiquidCrystal_I2C_ByVac::send(uint8_t value, uint8_t mode)
   Wire.beginTransmission(_Addr);
   Wire.write(mode+1); // map COMMAND (0) -> ByVac command code 0x01/ DATA  (1) ->  ByVac command code 0x02
   Wire.write(value);
-  Wire.endTransmission();
+  if ( Wire.endTransmission() != 0 )
+  {
+     transferError();
+  }
 }
@@ -81,6 +81,21 @@ public:
     LCD_5x10DOTS.
     */
    virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+   
+   /*!
+    @function
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the I2C interface and attaches to an LCD that has
+    kept its configuration and contents while the MCU was reset. 
+    @see LCD::beginWarm.
+    
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows, 
+                          uint8_t charsize = LCD_5x8DOTS);
 
    /*!
     @function
@@ -118,6 +133,13 @@ public:
 
 private:
 
+   /*!
+    @method     
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the I2C interface, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+   
    /*!
     @method
     @abstract   Initializes the LCD class
@@ -0,0 +1,208 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_I2C_COG.cpp
+// This file implements a driver for the LCD controllers with a native I2C
+// interface found on chip-on-glass (COG) modules.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LiquidCrystal_I2C_COG.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+
+// Control bytes, Co = 0: the rest of the transaction goes to the register
+#define COG_COMMAND       0x00   // RS = 0, instructions
+#define COG_DATA          0x40   // RS = 1, DDRAM or CGRAM data
+
+// Default contrast, adjusted with setContrast
+#define COG_CONTRAST      0x20
+
+// ST7032 extended instruction set (IS = 1)
+#define ST7032_IS         0x01   // Function set, extended instructions
+#define ST7032_OSC        0x14   // 1/5 bias, internal oscillator
+#define ST7032_CONTRAST   0x70   // Contrast low bits C3..C0
+#define ST7032_POWER      0x54   // Booster on, contrast high bits C5..C4
+#define ST7032_FOLLOWER   0x6C   // Voltage follower on, amplifier ratio 4
+
+// PCF2119 instruction set
+#define PCF2119_DL        0x10   // Function set, 8 bit interface
+#define PCF2119_M         0x04   // Function set, 2 lines
+#define PCF2119_H         0x01   // Function set, extended instructions
+#define PCF2119_DISPCONF  0x04   // Columns left to right, rows top to bottom
+#define PCF2119_SCRCONF   0x02   // Screen not split
+#define PCF2119_ICON      0x08   // Icons off
+#define PCF2119_TEMP      0x10   // Temperature coefficient 0
+#define PCF2119_HVGEN     0x42   // 3 stage voltage multiplier
+#define PCF2119_VA        0x80   // VLCD of the character mode
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_I2C_COG::LiquidCrystal_I2C_COG( uint8_t lcd_Addr,
+                                              t_cogController controller )
+{
+   _Addr = lcd_Addr;
+   _controller = controller;
+   _contrast = COG_CONTRAST;
+
+   // The I2C interface of the controllers is always 8 bits
+   _displayfunction = LCD_8BITMODE | LCD_1LINE | LCD_5x8DOTS;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void LiquidCrystal_I2C_COG::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   Wire.begin();
+   LCD::begin ( cols, lines, dotsize );
+}
+
+//
+// beginWarm
+void LiquidCrystal_I2C_COG::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   Wire.begin();
+   LCD::beginWarm ( cols, lines, dotsize );
+}
+
+//
+// setContrast
+void LiquidCrystal_I2C_COG::setContrast ( uint8_t value )
+{
+   _contrast = value & 0x3F;
+
+   // The contrast is part of the setup following a function set
+   if ( _controller != COG_AIP31068 )
+   {
+      functionSet ( LCD_FUNCTIONSET | _displayfunction );
+   }
+}
+
+// low level data pushing commands
+//----------------------------------------------------------------------------
+
+//
+// send - write either command or data
+void LiquidCrystal_I2C_COG::send(uint8_t value, uint8_t mode)
+{
+   // The interface is 8 bits, nibbles are never sent
+   if ( mode == FOUR_BITS )
+   {
+      return;
+   }
+
+   if ( ( mode == COMMAND ) && ( ( value & 0xE0 ) == LCD_FUNCTIONSET ) )
+   {
+      functionSet ( value );
+   }
+   else
+   {
+      writeStream ( ( mode == LCD_DATA ) ? COG_DATA : COG_COMMAND, &value, 1 );
+   }
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// startInterface
+void LiquidCrystal_I2C_COG::startInterface()
+{
+   Wire.begin();
+}
+
+//
+// sendBulk
+void LiquidCrystal_I2C_COG::sendBulk(const uint8_t *data, uint8_t len)
+{
+   while ( len > 0 )
+   {
+      uint8_t chunk = ( len > LCD_COG_CHUNK ) ? LCD_COG_CHUNK : len;
+
+      writeStream ( COG_DATA, data, chunk );
+      data += chunk;
+      len  -= chunk;
+   }
+}
+
+//
+// writeStream
+void LiquidCrystal_I2C_COG::writeStream(uint8_t control, const uint8_t *data,
+                                        uint8_t len)
+{
+   Wire.beginTransmission(_Addr);
+   Wire.write(control);
+   while ( len-- > 0 )
+   {
+      Wire.write(*data++);
+   }
+   if ( Wire.endTransmission() != 0 )
+   {
+      transferError();
+   }
+}
+
+//
+// functionSet
+// The LCD voltage is set up in the extended instruction set, every function
+// set (initialisation, resync) restores it. The instructions are streamed in
+// a single transaction ending in the standard instruction set.
+void LiquidCrystal_I2C_COG::functionSet(uint8_t value)
+{
+   uint8_t setup[8];
+   uint8_t len = 0;
+
+   switch ( _controller )
+   {
+      case COG_ST7032:
+         // DL, N and DH (double height) match the HD44780 function set
+         setup[len++] = value | ST7032_IS;
+         setup[len++] = ST7032_OSC;
+         setup[len++] = ST7032_CONTRAST | ( _contrast & 0x0F );
+         setup[len++] = ST7032_POWER | ( _contrast >> 4 );
+         setup[len++] = ST7032_FOLLOWER;
+         setup[len++] = value;
+         break;
+
+      case COG_PCF2119:
+         value = LCD_FUNCTIONSET | ( ( value & LCD_8BITMODE ) ? PCF2119_DL : 0 ) |
+                 ( ( value & LCD_2LINE ) ? PCF2119_M : 0 );
+         setup[len++] = value | PCF2119_H;
+         setup[len++] = PCF2119_DISPCONF;
+         setup[len++] = PCF2119_SCRCONF;
+         setup[len++] = PCF2119_ICON;
+         setup[len++] = PCF2119_TEMP;
+         setup[len++] = PCF2119_HVGEN;
+         setup[len++] = PCF2119_VA | _contrast;
+         setup[len++] = value;
+         break;
+
+      default:
+         setup[len++] = value;
+         break;
+   }
+   writeStream ( COG_COMMAND, setup, len );
+}
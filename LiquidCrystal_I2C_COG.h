@@ -0,0 +1,197 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_I2C_COG.h
+// This file implements a driver for the LCD controllers with a native I2C
+// interface found on chip-on-glass (COG) modules.
+//
+// @brief
+// The ST7032, AiP31068 and PCF2119 controllers are HD44780 compatible and
+// are connected directly to the I2C bus, without an IO expander. Every I2C
+// transaction starts with a control byte (Co, RS) followed by whole bytes:
+// there are no nibbles and no enable pulses to drive. With Co = 0 all the
+// bytes of the transaction go to the same register, this driver streams the
+// text written to the LCD (print) and the CGRAM uploads as few transactions
+// as possible, the bus carries 1 byte per character plus the control byte.
+//
+// Streaming relies on the bus being slower than the controller: at the
+// default 100kHz clock a byte lasts 90us, the controllers need less than 30us
+// to store it.
+//
+// The controllers are write only, the instructions are timed with their
+// worst case execution time.
+//
+// Usage:
+//    LiquidCrystal_I2C_COG lcd(0x3E, COG_ST7032);
+//    lcd.begin(16, 2);
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef LiquidCrystal_I2C_COG_h
+#define LiquidCrystal_I2C_COG_h
+#include <inttypes.h>
+#include <Print.h>
+
+#if defined(__AVR_ATtiny84__) || (__AVR_ATtiny2313__) || defined (__AVR_ATtiny85__)
+
+#include "TinyWireM.h" // include this if ATtiny84 or ATtiny85 or ATtiny2313
+
+#define Wire TinyWireM
+
+#else
+
+#if (ARDUINO < 10000)
+   #include <../Wire/Wire.h>
+#else
+   #include <Wire.h>
+#endif
+
+#endif
+
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Maximum data bytes of a transaction.
+ @discussion Number of bytes streamed after the control byte in a single I2C
+ transaction, limited by the buffer of the Wire library (32 bytes).
+ */
+#ifndef LCD_COG_CHUNK
+#define LCD_COG_CHUNK     31
+#endif
+
+/*!
+ @typedef
+ @abstract   LCD controller of the module.
+ @discussion The controllers differ in the setup of the LCD voltage and
+ contrast.
+ */
+typedef enum { COG_ST7032, COG_AIP31068, COG_PCF2119 } t_cogController;
+
+class LiquidCrystal_I2C_COG : public LCD
+{
+public:
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables and defines the I2C address and
+    the controller of the LCD. The constructor does not initialize the LCD.
+
+    @param      lcd_Addr[in] I2C address of the LCD controller, 0x3E for the
+    ST7032 and AiP31068, 0x3A or 0x3B for the PCF2119.
+    @param      controller[in] LCD controller: COG_ST7032, COG_AIP31068 or
+    COG_PCF2119.
+    */
+   LiquidCrystal_I2C_COG (uint8_t lcd_Addr,
+                          t_cogController controller = COG_ST7032);
+
+   /*!
+    @function
+    @abstract   LCD initialization and associated HW.
+    @discussion Initializes the LCD to a given size (col, row). This methods
+    initializes the LCD, therefore, it MUST be called prior to using any other
+    method from this class or parent class.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the I2C interface and attaches to an LCD that has
+    kept its configuration and contents while the MCU was reset.
+    @see LCD::beginWarm.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows,
+                          uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   Send a particular value to the LCD.
+    @discussion Sends a particular value to the LCD for writing to the LCD or
+    as an LCD command. A function set is followed by the voltage and contrast
+    setup of the controller.
+
+    Users should never call this method.
+
+    @param      value[in] Value to send to the LCD.
+    @param      mode[in] LCD_DATA - write to the LCD DDRAM or CGRAM, COMMAND -
+    write a command to the LCD.
+    */
+   virtual void send(uint8_t value, uint8_t mode);
+
+   /*!
+    @function
+    @abstract   Sets the LCD contrast.
+    @discussion Sets the contrast (LCD voltage) of the ST7032 (0..63) and
+    PCF2119 (0..63) controllers, the AiP31068 has no contrast control. The
+    value is kept across initialisations.
+
+    @param      value[in] contrast.
+    */
+   void setContrast ( uint8_t value );
+
+private:
+
+   /*!
+    @method
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the I2C interface, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+
+   /*!
+    @function
+    @abstract   Send data to the LCD.
+    @discussion Streams the values after a single control byte, in
+    transactions of up to LCD_COG_CHUNK bytes. @see LCD::sendBulk
+    */
+   virtual void sendBulk(const uint8_t *data, uint8_t len);
+
+   /*!
+    @function
+    @abstract   Writes an I2C transaction.
+    @discussion Writes a control byte followed by the values.
+
+    @param      control[in] control byte.
+    @param      data[in] values to write.
+    @param      len[in] number of values, up to LCD_COG_CHUNK.
+    */
+   void writeStream(uint8_t control, const uint8_t *data, uint8_t len);
+
+   /*!
+    @function
+    @abstract   Sends a function set.
+    @discussion Maps the function set to the controller and sends it with
+    the voltage and contrast setup of the extended instruction set.
+
+    @param      value[in] HD44780 function set.
+    */
+   void functionSet(uint8_t value);
+
+   uint8_t _Addr;                 // I2C Address of the LCD controller
+   t_cogController _controller;   // LCD controller
+   uint8_t _contrast;             // Contrast
+};
+
+#endif
@@ -0,0 +1,231 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_MCP23S.cpp
+// This file implements a basic liquid crystal library that comes as standard
+// in the Arduino SDK but using an SPI IO expander backpack.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "MCP23SIO.h"
+#include "LiquidCrystal_MCP23S.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+
+// Default pin mapping of the MCP23S08, the same as the I2C backpacks
+// ---------------------------------------------------------------------------
+#define EN 6  // Enable bit
+#define RW 5  // Read/Write bit
+#define RS 4  // Register select bit
+#define D4 0
+#define D5 1
+#define D6 2
+#define D7 3
+
+/*!
+ @defined
+ @abstract   LCD execution time.
+ @discussion Time in microseconds the LCD takes to execute a data write or
+ a command other than clear and home. The SPI transfers are shorter than it.
+ */
+#define EXEC_TIME 37
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr )
+{
+   config(cs, hwAddr, EN, RW, RS, D4, D5, D6, D7, false);
+}
+
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr,
+                                            uint8_t backlighPin,
+                                            t_backlighPol pol = POSITIVE )
+{
+   config(cs, hwAddr, EN, RW, RS, D4, D5, D6, D7, false);
+   setBacklightPin(backlighPin, pol);
+}
+
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr,
+                                            uint8_t En, uint8_t Rw, uint8_t Rs,
+                                            uint8_t d4, uint8_t d5, uint8_t d6,
+                                            uint8_t d7 )
+{
+   config(cs, hwAddr, En, Rw, Rs, d4, d5, d6, d7, false);
+}
+
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr,
+                                            uint8_t En, uint8_t Rw, uint8_t Rs,
+                                            uint8_t d4, uint8_t d5, uint8_t d6,
+                                            uint8_t d7, uint8_t backlighPin,
+                                            t_backlighPol pol = POSITIVE )
+{
+   config(cs, hwAddr, En, Rw, Rs, d4, d5, d6, d7, false);
+   setBacklightPin(backlighPin, pol);
+}
+
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr,
+                                            uint8_t En, uint8_t Rw, uint8_t Rs )
+{
+   config(cs, hwAddr, En, Rw, Rs, D4, D5, D6, D7, true);
+}
+
+LiquidCrystal_MCP23S::LiquidCrystal_MCP23S( uint8_t cs, uint8_t hwAddr,
+                                            uint8_t En, uint8_t Rw, uint8_t Rs,
+                                            uint8_t backlighPin,
+                                            t_backlighPol pol = POSITIVE )
+{
+   config(cs, hwAddr, En, Rw, Rs, D4, D5, D6, D7, true);
+   setBacklightPin(backlighPin, pol);
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void LiquidCrystal_MCP23S::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   init();     // Initialise the SPI expander interface
+   LCD::begin ( cols, lines, dotsize );
+}
+
+//
+// beginWarm
+void LiquidCrystal_MCP23S::beginWarm(uint8_t cols, uint8_t lines,
+                                     uint8_t dotsize)
+{
+   init();     // Initialise the SPI expander interface
+   LCD::beginWarm ( cols, lines, dotsize );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// startInterface
+void LiquidCrystal_MCP23S::startInterface()
+{
+   init();     // Initialise the SPI expander interface
+}
+
+//
+// portWrite
+bool LiquidCrystal_MCP23S::portWrite(const uint8_t *values, uint8_t len)
+{
+   if ( !_io.beginBurst () )
+   {
+      return ( false );
+   }
+
+   // The expander stays selected for the whole transfer, only the bytes sent
+   // to the LCD are paced.
+   for ( uint8_t i = 0; i < len; i++ )
+   {
+      if ( ( i % 4 ) == 0 )
+      {
+         execWait ();
+      }
+      _io.burst ( values[i] );
+      if ( ( ( i % 4 ) == 3 ) || ( i == len - 1 ) )
+      {
+         _sentAt = micros ();
+      }
+   }
+   _io.endBurst ();
+   return ( true );
+}
+
+//
+// init
+int LiquidCrystal_MCP23S::init()
+{
+   int status = 0;
+
+   // initialize the backpack IO expander
+   // and display functions.
+   // ------------------------------------------------------------------------
+   if ( _io.begin ( _cs, _hwAddr, _eightBit ) == 1 )
+   {
+      _displayfunction = ( _eightBit ? LCD_8BITMODE : LCD_4BITMODE ) |
+                         LCD_1LINE | LCD_5x8DOTS;
+      status = 1;
+   }
+   return ( status );
+}
+
+//
+// config
+void LiquidCrystal_MCP23S::config (uint8_t cs, uint8_t hwAddr, uint8_t En,
+                                   uint8_t Rw, uint8_t Rs, uint8_t d4,
+                                   uint8_t d5, uint8_t d6, uint8_t d7,
+                                   bool eightBit )
+{
+   _cs       = cs;
+   _hwAddr   = hwAddr;
+   _eightBit = eightBit;
+   _sentAt   = 0;
+
+   mapPins ( En, Rw, Rs, d4, d5, d6, d7 );
+
+   // portWrite paces the characters, a string goes out in a few bursts
+   _bulkLen  = LCDPORT_BULK;
+}
+
+//
+// buildFrames
+uint8_t LiquidCrystal_MCP23S::buildFrames(uint8_t value, uint8_t mode,
+                                          uint8_t *burst)
+{
+   uint8_t control = _backlightStsMask;
+
+   if ( !_eightBit )
+   {
+      return ( LCDPort::buildFrames ( value, mode, burst ) );
+   }
+
+   if ( mode == LCD_DATA )
+   {
+      control |= _Rs;
+   }
+
+   // Port A, port B, port A, port B: the data is set up while En is high and
+   // latched on its falling edge.
+   burst[0] = control | _En;
+   burst[1] = value;
+   burst[2] = control;
+   burst[3] = value;
+
+   return ( 4 );
+}
+
+//
+// execWait
+void LiquidCrystal_MCP23S::execWait()
+{
+   unsigned long elapsed = micros () - _sentAt;
+
+   if ( elapsed < EXEC_TIME )
+   {
+      delayMicroseconds ( EXEC_TIME - elapsed );
+   }
+}
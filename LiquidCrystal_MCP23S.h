@@ -0,0 +1,210 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_MCP23S.h
+// This file implements a basic liquid crystal library that comes as standard
+// in the Arduino SDK but using an SPI IO expander backpack.
+//
+// @brief
+// This class drives an HD44780 LCD through an MCP23S08 or MCP23S17 SPI IO
+// expander. The SPI bus is far faster than the I2C backpacks: the expander
+// is kept selected while the text written to the LCD (print) is sent, the
+// enable pulses of all the characters go out in a single SPI burst, paced
+// to the execution time of the LCD.
+//
+// MCP23S08: the LCD is driven in 4 bit mode, all the LCD lines and the
+// backlight on the 8 pins of the expander (same default mapping as the I2C
+// backpacks).
+// MCP23S17: the LCD is driven in 8 bit mode, the control lines and the
+// backlight on port A, D0 to D7 on the pins 0 to 7 of port B. Selected by the
+// constructors taking no data lines but the control lines.
+//
+// Several expanders can share the chip select line, told apart by their
+// hardware address (A2..A0 pins).
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef LiquidCrystal_MCP23S_h
+#define LiquidCrystal_MCP23S_h
+
+#include <inttypes.h>
+#include <Print.h>
+
+#include "MCP23SIO.h"
+#include "LCDPort.h"
+
+
+class LiquidCrystal_MCP23S : public LCDPort
+{
+public:
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables for an LCD in 4 bit mode on an
+    MCP23S08 with the default pin mapping. The constructor does not
+    initialize the LCD.
+
+    @param      cs[in] pin connected to the chip select of the expander.
+    @param      hwAddr[in] hardware address of the expander.
+    */
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr = 0);
+   // Constructor with backlight control
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr, uint8_t backlighPin,
+                         t_backlighPol pol);
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables for an LCD in 4 bit mode on an
+    MCP23S08. The constructor does not initialize the LCD.
+
+    @param      cs[in] pin connected to the chip select of the expander.
+    @param      hwAddr[in] hardware address of the expander.
+    @param      En[in] LCD En (Enable) pin connected to the IO extender module
+    @param      Rw[in] LCD Rw (Read/write) pin connected to the IO extender module
+    @param      Rs[in] LCD Rs (Reset) pin connected to the IO extender module
+    @param      d4[in] LCD data 0 pin map on IO extender module
+    @param      d5[in] LCD data 1 pin map on IO extender module
+    @param      d6[in] LCD data 2 pin map on IO extender module
+    @param      d7[in] LCD data 3 pin map on IO extender module
+    */
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr, uint8_t En, uint8_t Rw,
+                         uint8_t Rs, uint8_t d4, uint8_t d5, uint8_t d6,
+                         uint8_t d7);
+   // Constructor with backlight control
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr, uint8_t En, uint8_t Rw,
+                         uint8_t Rs, uint8_t d4, uint8_t d5, uint8_t d6,
+                         uint8_t d7, uint8_t backlighPin, t_backlighPol pol);
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables for an LCD in 8 bit mode on an
+    MCP23S17: the control lines on port A and D0 to D7 on port B. The
+    constructor does not initialize the LCD.
+
+    @param      cs[in] pin connected to the chip select of the expander.
+    @param      hwAddr[in] hardware address of the expander.
+    @param      En[in] LCD En (Enable) pin of port A
+    @param      Rw[in] LCD Rw (Read/write) pin of port A
+    @param      Rs[in] LCD Rs (Reset) pin of port A
+    */
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr, uint8_t En, uint8_t Rw,
+                         uint8_t Rs);
+   // Constructor with backlight control, the backlight pin is on port A
+   LiquidCrystal_MCP23S (uint8_t cs, uint8_t hwAddr, uint8_t En, uint8_t Rw,
+                         uint8_t Rs, uint8_t backlighPin, t_backlighPol pol);
+
+   /*!
+    @function
+    @abstract   LCD initialization and associated HW.
+    @discussion Initializes the LCD to a given size (col, row). This methods
+    initializes the LCD, therefore, it MUST be called prior to using any other
+    method from this class or parent class.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the SPI expander and attaches to an LCD that has
+    kept its configuration and contents while the MCU was reset.
+    @see LCD::beginWarm.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows,
+                          uint8_t charsize = LCD_5x8DOTS);
+
+private:
+
+   /*!
+    @method
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the SPI expander, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+
+   /*!
+    @method
+    @abstract   Writes values to the SPI expander.
+    @discussion All the values are written in a single SPI burst, the bytes
+    sent to the LCD (4 values each) paced to its execution time.
+    @see LCDPort::portWrite
+    */
+   virtual bool portWrite(const uint8_t *values, uint8_t len);
+
+   /*!
+    @method
+    @abstract   Initializes the LCD class
+    @discussion Initializes the LCD class and IO expansion module.
+    */
+   int  init();
+
+   /*!
+    @function
+    @abstract   Initialises class private variables
+    @discussion This is the class single point for initialising private variables.
+
+    @param      cs[in] pin connected to the chip select of the expander.
+    @param      hwAddr[in] hardware address of the expander.
+    @param      En[in] LCD En (Enable) pin connected to the IO extender module
+    @param      Rw[in] LCD Rw (Read/write) pin connected to the IO extender module
+    @param      Rs[in] LCD Rs (Reset) pin connected to the IO extender module
+    @param      d4[in] LCD data 0 pin map on IO extender module
+    @param      d5[in] LCD data 1 pin map on IO extender module
+    @param      d6[in] LCD data 2 pin map on IO extender module
+    @param      d7[in] LCD data 3 pin map on IO extender module
+    @param      eightBit[in] 8 bit mode on an MCP23S17.
+    */
+   void config (uint8_t cs, uint8_t hwAddr, uint8_t En, uint8_t Rw, uint8_t Rs,
+                uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7, bool eightBit);
+
+   /*!
+    @method
+    @abstract   Expander values to send a value to the LCD.
+    @discussion In 8 bit mode the values alternate between port A (control)
+    and port B (data). @see LCDPort::buildFrames
+
+    @param      value[in] value to send.
+    @param      mode[in] LCD_DATA, COMMAND or FOUR_BITS.
+    @param      burst[out] expander values, room for 4.
+    @result     number of expander values.
+    */
+   virtual uint8_t buildFrames(uint8_t value, uint8_t mode, uint8_t *burst);
+
+   /*!
+    @method
+    @abstract   Waits for the LCD to execute the last transfer.
+    @discussion Only the part of the execution time not already elapsed is
+    waited.
+    */
+   void execWait();
+
+   MCP23SIO _io;              // MCP23S08/MCP23S17 expansion module driver
+   uint8_t  _cs;              // Chip select pin
+   uint8_t  _hwAddr;          // Hardware address of the expander
+   bool     _eightBit;        // 8 bit mode on an MCP23S17
+   unsigned long _sentAt;     // Time of the last transfer to the LCD
+};
+
+#endif
@@ -0,0 +1,251 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_OLED.cpp
+// This file implements a driver for the US2066 and SSD1311 character OLED
+// controllers connected to the I2C bus.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LiquidCrystal_OLED.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+
+// Control bytes, Co = 0: the rest of the transaction goes to the register
+#define OLED_COMMAND       0x00   // D/C# = 0, instructions
+#define OLED_DATA          0x40   // D/C# = 1, DDRAM or CGRAM data
+
+// Default contrast, adjusted with setContrast
+#define OLED_CONTRAST      0x7F
+
+// Extended instruction set (RE = 1) and OLED command set (SD = 1)
+#define OLED_RE            0x02   // Function set, extended instructions
+#define OLED_EXT_FUNCTION  0x08   // Extended function set, 5 dot font
+#define OLED_NW            0x01   // Extended function set, 3 or 4 lines
+#define OLED_SD_ON         0x79   // Enter the OLED command set
+#define OLED_SD_OFF        0x78   // Leave the OLED command set
+#define OLED_SET_CONTRAST  0x81   // Contrast control, followed by the value
+#define OLED_SET_FADE      0x23   // Fade out and blinking, followed by the mode
+
+// DDRAM positions of a line of 3 and 4 line displays
+#define OLED_LINE          0x20
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_OLED::LiquidCrystal_OLED( uint8_t lcd_Addr )
+{
+   _Addr = lcd_Addr;
+   _contrast = OLED_CONTRAST;
+   _clearExec = LCD_OLED_CLEAR_EXEC;
+   _pollCost  = LCD_OLED_POLL_COST;
+
+   // The I2C interface of the controllers is always 8 bits
+   _displayfunction = LCD_8BITMODE | LCD_1LINE | LCD_5x8DOTS;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void LiquidCrystal_OLED::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   Wire.begin();
+   LCD::begin ( cols, lines, dotsize );
+}
+
+//
+// beginWarm
+void LiquidCrystal_OLED::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   Wire.begin();
+   LCD::beginWarm ( cols, lines, dotsize );
+}
+
+//
+// setContrast
+void LiquidCrystal_OLED::setContrast ( uint8_t value )
+{
+   _contrast = value;
+   oledCommand ( OLED_SET_CONTRAST, _contrast );
+}
+
+//
+// setFade
+void LiquidCrystal_OLED::setFade ( uint8_t mode, uint8_t interval )
+{
+   oledCommand ( OLED_SET_FADE, mode | ( interval & 0x0F ) );
+}
+
+// low level data pushing commands
+//----------------------------------------------------------------------------
+
+//
+// send - write either command or data
+void LiquidCrystal_OLED::send(uint8_t value, uint8_t mode)
+{
+   // The interface is 8 bits, nibbles are never sent
+   if ( mode == FOUR_BITS )
+   {
+      return;
+   }
+
+   if ( ( mode == COMMAND ) && ( ( value & 0xE0 ) == LCD_FUNCTIONSET ) )
+   {
+      // The number of lines and the contrast are set in the extended
+      // instruction set, every function set (initialisation, resync)
+      // restores them.
+      uint8_t setup[7];
+
+      setup[0] = ( value & ~LCD_5x10DOTS ) | OLED_RE;
+      setup[1] = OLED_EXT_FUNCTION | ( ( _numlines > 2 ) ? OLED_NW : 0 );
+      setup[2] = OLED_SD_ON;
+      setup[3] = OLED_SET_CONTRAST;
+      setup[4] = _contrast;
+      setup[5] = OLED_SD_OFF;
+      setup[6] = value;
+      writeStream ( OLED_COMMAND, setup, sizeof ( setup ) );
+      return;
+   }
+
+   if ( ( mode == COMMAND ) && ( value & LCD_SETDDRAMADDR ) )
+   {
+      value = LCD_SETDDRAMADDR | mapAddr ( value & ~LCD_SETDDRAMADDR, true );
+   }
+   writeStream ( ( mode == LCD_DATA ) ? OLED_DATA : OLED_COMMAND, &value, 1 );
+}
+
+//
+// recv - read busy flag and address or data
+int LiquidCrystal_OLED::recv(uint8_t mode)
+{
+   uint8_t value;
+
+   Wire.beginTransmission(_Addr);
+   Wire.write( ( mode == LCD_DATA ) ? OLED_DATA : OLED_COMMAND );
+   if ( ( Wire.endTransmission(false) != 0 ) ||
+        ( Wire.requestFrom(_Addr, (uint8_t)1) != 1 ) )
+   {
+      return ( -1 );
+   }
+   value = Wire.read();
+
+   if ( mode == COMMAND )
+   {
+      value = ( value & LCD_BUSY_FLAG ) |
+              mapAddr ( value & ~LCD_BUSY_FLAG, false );
+   }
+   return ( value );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// startInterface
+void LiquidCrystal_OLED::startInterface()
+{
+   Wire.begin();
+}
+
+//
+// sendBulk
+void LiquidCrystal_OLED::sendBulk(const uint8_t *data, uint8_t len)
+{
+   while ( len > 0 )
+   {
+      uint8_t chunk = ( len > LCD_OLED_CHUNK ) ? LCD_OLED_CHUNK : len;
+
+      writeStream ( OLED_DATA, data, chunk );
+      data += chunk;
+      len  -= chunk;
+   }
+}
+
+//
+// writeStream
+void LiquidCrystal_OLED::writeStream(uint8_t control, const uint8_t *data,
+                                     uint8_t len)
+{
+   Wire.beginTransmission(_Addr);
+   Wire.write(control);
+   while ( len-- > 0 )
+   {
+      Wire.write(*data++);
+   }
+   if ( Wire.endTransmission() != 0 )
+   {
+      transferError();
+   }
+}
+
+//
+// oledCommand
+void LiquidCrystal_OLED::oledCommand(uint8_t command, uint8_t value)
+{
+   uint8_t functionSet = LCD_FUNCTIONSET | _displayfunction;
+   uint8_t stream[6];
+
+   stream[0] = ( functionSet & ~LCD_5x10DOTS ) | OLED_RE;
+   stream[1] = OLED_SD_ON;
+   stream[2] = command;
+   stream[3] = value;
+   stream[4] = OLED_SD_OFF;
+   stream[5] = functionSet;
+   writeStream ( OLED_COMMAND, stream, sizeof ( stream ) );
+}
+
+//
+// mapAddr
+// The library places the lines of 4 line displays as an HD44780 does: lines
+// 0 and 1 at 0x00 and 0x40, lines 2 and 3 following them. The controller
+// places each line at a multiple of 0x20.
+uint8_t LiquidCrystal_OLED::mapAddr(uint8_t addr, bool toOled)
+{
+   const uint8_t rowOffsetsDef[]   = { 0x00, 0x40, 0x14, 0x54 };
+   const uint8_t rowOffsetsLarge[] = { 0x00, 0x40, 0x10, 0x50 }; // 16x4
+   const uint8_t *rowOffsets;
+
+   if ( _numlines <= 2 )
+   {
+      return ( addr );
+   }
+
+   rowOffsets = ( _cols == 16 && _numlines == 4 ) ? rowOffsetsLarge :
+                                                     rowOffsetsDef;
+   if ( !toOled )
+   {
+      uint8_t col = addr % OLED_LINE;
+
+      return ( ( col < _cols ) ? rowOffsets[addr / OLED_LINE] + col : addr );
+   }
+
+   for ( uint8_t row = 0; row < _numlines; row++ )
+   {
+      if ( ( addr >= rowOffsets[row] ) && ( addr < rowOffsets[row] + _cols ) )
+      {
+         return ( ( row * OLED_LINE ) + ( addr - rowOffsets[row] ) );
+      }
+   }
+   return ( addr );
+}
@@ -0,0 +1,254 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_OLED.h
+// This file implements a driver for the US2066 and SSD1311 character OLED
+// controllers connected to the I2C bus.
+//
+// @brief
+// The US2066 and SSD1311 are HD44780 compatible character OLED controllers
+// with a native I2C interface: a control byte (Co, D/C#) followed by whole
+// bytes, the text written to the display (print) and the CGRAM uploads are
+// streamed in as few transactions as possible.
+//
+// The controllers are much faster than an HD44780. The driver reads the busy
+// flag, the waits of the clear and home instructions only last what the
+// controller needs, bounded by LCD_OLED_CLEAR_EXEC instead of the 2ms of
+// HOME_CLEAR_EXEC. The other instructions complete before the next I2C
+// transaction can start.
+//
+// On top of the LCD methods the driver controls the contrast (brightness)
+// and the fade out / blinking of the whole display.
+//
+// 3 and 4 line displays use a DDRAM layout of 32 positions per line, the
+// driver maps the HD44780 layout used by the library to it. On them, text
+// written past the end of a line doesn't continue on another line.
+//
+// Usage:
+//    LiquidCrystal_OLED lcd(0x3C);
+//    lcd.begin(20, 4);
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef LiquidCrystal_OLED_h
+#define LiquidCrystal_OLED_h
+#include <inttypes.h>
+#include <Print.h>
+
+#if defined(__AVR_ATtiny84__) || (__AVR_ATtiny2313__) || defined (__AVR_ATtiny85__)
+
+#include "TinyWireM.h" // include this if ATtiny84 or ATtiny85 or ATtiny2313
+
+#define Wire TinyWireM
+
+#else
+
+#if (ARDUINO < 10000)
+   #include <../Wire/Wire.h>
+#else
+   #include <Wire.h>
+#endif
+
+#endif
+
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Duration of the clear and home commands of the OLED controllers.
+ @discussion Maximum time in microseconds waited for the clear and home
+ instructions, the busy flag ends the wait as soon as the controller is done.
+ */
+#ifndef LCD_OLED_CLEAR_EXEC
+#define LCD_OLED_CLEAR_EXEC   1000
+#endif
+
+/*!
+ @defined
+ @abstract   Duration of a busy flag read.
+ @discussion Time in microseconds of a busy flag read at 100kHz: a control
+ byte written and a byte read, each with the address.
+ */
+#ifndef LCD_OLED_POLL_COST
+#define LCD_OLED_POLL_COST    400
+#endif
+
+/*!
+ @defined
+ @abstract   Maximum data bytes of a transaction.
+ @discussion Number of bytes streamed after the control byte in a single I2C
+ transaction, limited by the buffer of the Wire library (32 bytes).
+ */
+#ifndef LCD_OLED_CHUNK
+#define LCD_OLED_CHUNK        31
+#endif
+
+/*!
+ @defined
+ @abstract   Fade modes.
+ @discussion Modes of setFade: no fading, the display fades out once, the
+ display fades out and in continuously (blinking).
+ */
+#define OLED_FADE_OFF         0x00
+#define OLED_FADE_OUT         0x20
+#define OLED_FADE_BLINK       0x30
+
+class LiquidCrystal_OLED : public LCD
+{
+public:
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables and defines the I2C address of the
+    display. The constructor does not initialize the display.
+
+    @param      lcd_Addr[in] I2C address of the controller, 0x3C or 0x3D
+    depending on the SA0 pin.
+    */
+   LiquidCrystal_OLED (uint8_t lcd_Addr);
+
+   /*!
+    @function
+    @abstract   LCD initialization and associated HW.
+    @discussion Initializes the LCD to a given size (col, row). This methods
+    initializes the LCD, therefore, it MUST be called prior to using any other
+    method from this class or parent class.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the I2C interface and attaches to a display that
+    has kept its configuration and contents while the MCU was reset.
+    @see LCD::beginWarm.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
+    */
+   virtual void beginWarm(uint8_t cols, uint8_t rows,
+                          uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   Send a particular value to the LCD.
+    @discussion Sends a particular value to the display for writing to the
+    DDRAM or CGRAM or as a command. A function set is followed by the line
+    and contrast setup of the controller.
+
+    Users should never call this method.
+
+    @param      value[in] Value to send to the LCD.
+    @param      mode[in] LCD_DATA - write to the LCD DDRAM or CGRAM, COMMAND -
+    write a command to the LCD.
+    */
+   virtual void send(uint8_t value, uint8_t mode);
+
+   /*!
+    @function
+    @abstract   Receive a value from the LCD.
+    @discussion Reads the busy flag and address counter (COMMAND) or the data
+    at the current address (LCD_DATA). @see LCD::recv
+
+    @param      mode[in] COMMAND or LCD_DATA.
+    @result     the value read (0..255), -1 if the read failed.
+    */
+   virtual int recv(uint8_t mode);
+
+   /*!
+    @function
+    @abstract   Sets the display contrast.
+    @discussion Sets the contrast (segment current) of the display, the
+    value is kept across initialisations.
+
+    @param      value[in] contrast, 0..255.
+    */
+   void setContrast ( uint8_t value );
+
+   /*!
+    @function
+    @abstract   Fades the display out or makes it blink.
+    @discussion The controller fades the brightness of the whole display,
+    without any transfer from the MCU.
+
+    @param      mode[in] OLED_FADE_OFF, OLED_FADE_OUT or OLED_FADE_BLINK.
+    @param      interval[in] duration of a step of the fading, 0..15, each
+    step lasts 8 * (interval + 1) frames.
+    */
+   void setFade ( uint8_t mode, uint8_t interval );
+
+private:
+
+   /*!
+    @method
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the I2C interface, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+
+   /*!
+    @function
+    @abstract   Send data to the LCD.
+    @discussion Streams the values after a single control byte, in
+    transactions of up to LCD_OLED_CHUNK bytes. @see LCD::sendBulk
+    */
+   virtual void sendBulk(const uint8_t *data, uint8_t len);
+
+   /*!
+    @function
+    @abstract   Writes an I2C transaction.
+    @discussion Writes a control byte followed by the values.
+
+    @param      control[in] control byte.
+    @param      data[in] values to write.
+    @param      len[in] number of values, up to LCD_OLED_CHUNK.
+    */
+   void writeStream(uint8_t control, const uint8_t *data, uint8_t len);
+
+   /*!
+    @function
+    @abstract   Sends an OLED characterization command.
+    @discussion Sends a two byte command of the OLED command set, entering
+    and leaving the extended instruction set in the same transaction.
+
+    @param      command[in] command.
+    @param      value[in] parameter of the command.
+    */
+   void oledCommand(uint8_t command, uint8_t value);
+
+   /*!
+    @function
+    @abstract   Maps a DDRAM address to the controller.
+    @discussion Converts between the HD44780 layout of 4 line displays used
+    by the library and the layout of the controller (32 positions per line).
+
+    @param      addr[in] DDRAM address.
+    @param      toOled[in] true: library to controller, false: controller to
+    library.
+    @result     DDRAM address mapped.
+    */
+   uint8_t mapAddr(uint8_t addr, bool toOled);
+
+   uint8_t _Addr;                 // I2C Address of the controller
+   uint8_t _contrast;             // Contrast
+};
+
+#endif
@@ -45,22 +45,6 @@
 // CONSTANT  definitions
 // ---------------------------------------------------------------------------
 
-// flags for backlight control
-/*!
- @defined 
- @abstract   LCD_NOBACKLIGHT
- @discussion NO BACKLIGHT MASK
- */
-#define LCD_NOBACKLIGHT 0x00
-
-/*!
- @defined 
- @abstract   LCD_BACKLIGHT
- @discussion BACKLIGHT MASK used when backlight is on
- */
-#define LCD_BACKLIGHT   0xFF
-
-
 // Default library configuration parameters used by class constructor with
 // only the I2C address field.
 // ---------------------------------------------------------------------------
@@ -154,41 +138,32 @@ void LiquidCrystal_SI2C::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
    LCD::begin ( cols, lines, dotsize );   
 }
 
-
-// User commands - users can expand this section
-//----------------------------------------------------------------------------
-// Turn the (optional) backlight off/on
+//
+// startInterface
+void LiquidCrystal_SI2C::startInterface() 
+{
+   init();     // Initialise the I2C expander interface
+}
 
 //
-// setBacklightPin
-void LiquidCrystal_SI2C::setBacklightPin ( uint8_t value, t_backlighPol pol = POSITIVE )
+// beginWarm
+void LiquidCrystal_SI2C::beginWarm(uint8_t cols, uint8_t lines, uint8_t dotsize) 
 {
-   _backlightPinMask = ( 1 << value );
-   _polarity = pol;
-   setBacklight(BACKLIGHT_OFF);
+   init();     // Initialise the I2C expander interface
+   LCD::beginWarm ( cols, lines, dotsize );   
 }
 
+
+// User commands - users can expand this section
+//----------------------------------------------------------------------------
+// Turn the (optional) backlight off/on
+
 //
-// setBacklight
-void LiquidCrystal_SI2C::setBacklight( uint8_t value ) 
+// setAddressStore
+void LiquidCrystal_SI2C::setAddressStore ( t_i2cAddrLoad load, t_i2cAddrSave save )
 {
-   // Check if backlight is available
-   // ----------------------------------------------------
-   if ( _backlightPinMask != 0x0 )
-   {
-      // Check for polarity to configure mask accordingly
-      // ----------------------------------------------------------
-      if  (((_polarity == POSITIVE) && (value > 0)) || 
-           ((_polarity == NEGATIVE ) && ( value == 0 )))
-      {
-         _backlightStsMask = _backlightPinMask & LCD_BACKLIGHT;
-      }
-      else 
-      {
-         _backlightStsMask = _backlightPinMask & LCD_NOBACKLIGHT;
-      }
-      _si2cio.write( _backlightStsMask );
-   }
+   _addrLoad = load;
+   _addrSave = save;
 }
 
 
@@ -201,10 +176,15 @@ int LiquidCrystal_SI2C::init()
 {
    int status = 0;
    
+   if ( _autoAddr )
+   {
+      detectAddress ();
+   }
+   
    // initialize the backpack IO expander
    // and display functions.
    // ------------------------------------------------------------------------
-   if ( _si2cio.begin ( _Addr ) == 1 )
+   if ( ( _Addr != I2C_ADDR_AUTO ) && ( _si2cio.begin ( _Addr ) == 1 ) )
    {
       _si2cio.portMode ( OUTPUT );  // Set the entire IO extender to OUTPUT
       _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
@@ -214,26 +194,42 @@ int LiquidCrystal_SI2C::init()
    return ( status );
 }
 
+//
+// detectAddress
+void LiquidCrystal_SI2C::detectAddress ()
+{
+   uint8_t hint = _Addr;
+   
+   // Once detected, the address is kept for the next initialisations
+   if ( ( hint == I2C_ADDR_AUTO ) && ( _addrLoad != NULL ) )
+   {
+      hint = _addrLoad ();
+   }
+   
+   _Addr = SI2CIO::detect ( hint );
+   
+   if ( ( _Addr != I2C_ADDR_AUTO ) && ( _Addr != hint ) &&
+        ( _addrSave != NULL ) )
+   {
+      _addrSave ( _Addr );
+   }
+}
+
 //
 // config
 void LiquidCrystal_SI2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8_t Rs, 
                                 uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
 {
    _Addr = lcd_Addr; 
+   _autoAddr = ( lcd_Addr == I2C_ADDR_AUTO );
+   _addrLoad = NULL;
+   _addrSave = NULL;
    
-   _backlightPinMask = 0;
-   _backlightStsMask = LCD_NOBACKLIGHT;
-   _polarity = POSITIVE;
-   
-   _En = ( 1 << En );
-   _Rw = ( 1 << Rw );
-   _Rs = ( 1 << Rs );
+   mapPins ( En, Rw, Rs, d4, d5, d6, d7 );
    
-   // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );   
+   // Up to 400kHz the 2 port values between the enable pulses of two bytes
+   // take longer than the LCD execution time, a string can be streamed
+   _bulkLen = LCDPORT_BULK;
 }
 
 
@@ -242,58 +238,13 @@ void LiquidCrystal_SI2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8
 //----------------------------------------------------------------------------
 
 //
-// send - write either command or data
-void LiquidCrystal_SI2C::send(uint8_t value, uint8_t mode) 
+// portWrite
+bool LiquidCrystal_SI2C::portWrite (const uint8_t *values, uint8_t len)
 {
    // No need to use the delay routines since the time taken to write takes
    // longer that what is needed both for toggling and enable pin an to execute
    // the command.
-   
-   if ( mode == FOUR_BITS )
-   {
-      write4bits( (value & 0x0F), COMMAND );
-   }
-   else 
-   {
-      write4bits( (value >> 4), mode );
-      write4bits( (value & 0x0F), mode);
-   }
-}
-
-//
-// write4bits
-void LiquidCrystal_SI2C::write4bits ( uint8_t value, uint8_t mode ) 
-{
-   uint8_t pinMapValue = 0;
-   
-   // Map the value to LCD pin mapping
-   // --------------------------------
-   for ( uint8_t i = 0; i < 4; i++ )
-   {
-      if ( ( value & 0x1 ) == 1 )
-      {
-         pinMapValue |= _data_pins[i];
-      }
-      value = ( value >> 1 );
-   }
-   
-   // Is it a command or data
-   // -----------------------
-   if ( mode == LCD_DATA )
-   {
-      mode = _Rs;
-   }
-   
-   pinMapValue |= mode | _backlightStsMask;
-   pulseEnable ( pinMapValue );
-}
-
-//
-// pulseEnable
-void LiquidCrystal_SI2C::pulseEnable (uint8_t data)
-{
-   _si2cio.write (data | _En);   // En HIGH
-   _si2cio.write (data & ~_En);  // En LOW
+   return ( _si2cio.write ( values, len ) == 1 );
 }
 
 #endif // defined (__AVR__)
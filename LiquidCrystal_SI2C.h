@@ -38,10 +38,10 @@
 #include <Print.h>
 
 #include "SI2CIO.h"
-#include "LCD.h"
+#include "LCDPort.h"
 
 
-class LiquidCrystal_SI2C : public LCD 
+class LiquidCrystal_SI2C : public LCDPort
 {
 public:
    
@@ -117,41 +117,49 @@ public:
    
    /*!
     @function
-    @abstract   Send a particular value to the LCD.
-    @discussion Sends a particular value to the LCD for writing to the LCD or
-    as an LCD command.
+    @abstract   LCD warm initialization and associated HW.
+    @discussion Initializes the I2C interface and attaches to an LCD that has
+    kept its configuration and contents while the MCU was reset. 
+    @see LCD::beginWarm.
     
-    Users should never call this method.
-    
-    @param      value[in] Value to send to the LCD.
-    @param      mode[in] DATA - write to the LCD CGRAM, COMMAND - write a 
-    command to the LCD.
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] size of the characters of the LCD: LCD_5x8DOTS or
+    LCD_5x10DOTS.
     */
-   virtual void send(uint8_t value, uint8_t mode);
+   virtual void beginWarm(uint8_t cols, uint8_t rows, 
+                          uint8_t charsize = LCD_5x8DOTS);
    
    /*!
     @function
-    @abstract   Sets the pin to control the backlight.
-    @discussion Sets the pin in the device to control the backlight. This device
-    doesn't support dimming backlight capability.
+    @abstract   Sets the storage of the detected I2C address.
+    @discussion When the driver is created with I2C_ADDR_AUTO as address, the
+    address of the backpack is detected on initialisation (begin). The last
+    address found is probed first and the bus is only scanned if the backpack
+    doesn't answer there, the new address is then saved. A typical store is
+    a byte of the EEPROM.
     
-    @param      0: backlight off, 1..255: backlight on.
+    @param      load[in] function returning the last address saved.
+    @param      save[in] function saving the address detected.
     */
-   void setBacklightPin ( uint8_t value, t_backlighPol pol );
+   void setAddressStore ( t_i2cAddrLoad load, t_i2cAddrSave save );
    
    /*!
     @function
-    @abstract   Switch-on/off the LCD backlight.
-    @discussion Switch-on/off the LCD backlight.
-    The setBacklightPin has to be called before setting the backlight for
-    this method to work. @see setBacklightPin.
-    
-    @param      value: backlight mode (HIGH|LOW)
+    @abstract   I2C address of the backpack.
+    @result     address in use, I2C_ADDR_AUTO if it has not been detected.
     */
-   void setBacklight ( uint8_t value );
+   uint8_t getAddress ( void ) { return ( _Addr ); };
    
 private:
    
+   /*!
+    @method     
+    @abstract   Initializes the driver interface.
+    @discussion Initialises the I2C interface, used by LCD::beginAll.
+    */
+   virtual void startInterface();
+   
    /*!
     @method     
     @abstract   Initializes the LCD class
@@ -179,31 +187,26 @@ private:
    
    /*!
     @method     
-    @abstract   Writes an 4 bit value to the LCD.
-    @discussion Writes 4 bits (the least significant) to the LCD control data lines.
-    @param      value[in] Value to write to the LCD
-    @param      more[in]  Value to distinguish between command and data.
-    COMMAND == command, DATA == data.
+    @abstract   Detects the I2C address of the backpack.
+    @discussion Probes the current or last saved address and scans the bus if
+    the backpack is not there. @see setAddressStore
     */
-   void write4bits(uint8_t value, uint8_t mode);
+   void detectAddress ();
    
    /*!
     @method     
-    @abstract   Pulse the LCD enable line (En).
-    @discussion Sends a pulse of 1 uS to the Enable pin to execute an command
-    or write operation.
+    @abstract   Writes values to the IO expander.
+    @discussion All the values are written in a single I2C transaction.
+    @see LCDPort::portWrite
     */
-   void pulseEnable(uint8_t);
+   virtual bool portWrite(const uint8_t *values, uint8_t len);
    
    
    uint8_t _Addr;             // I2C Address of the IO expander
-   uint8_t _backlightPinMask; // Backlight IO pin mask
-   uint8_t _backlightStsMask; // Backlight status mask
+   bool    _autoAddr;         // Detect the I2C address on initialisation
+   t_i2cAddrLoad _addrLoad;   // Storage of the detected address
+   t_i2cAddrSave _addrSave;
    SI2CIO  _si2cio;            // I2CIO PCF8574* expansion module driver I2CLCDextraIO
-   uint8_t _En;               // LCD expander word for enable pin
-   uint8_t _Rw;               // LCD expander word for R/W pin
-   uint8_t _Rs;               // LCD expander word for Register Select pin
-   uint8_t _data_pins[4];     // LCD data lines
    
 };
 
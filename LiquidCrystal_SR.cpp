@@ -154,12 +154,25 @@ void LiquidCrystal_SR::shiftIt(uint8_t val)
    // latch. The shiftregister latch pin (STR, RCL or similar) is then
    // connected to the LCD enable pin. The LCD is (very likely) slower
    // to read the Enable pulse, and then reads the new contents of the SR.
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#if (FIO_MASKED_HOLD_US >= 1)
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
    {
       fio_digitalWrite_HIGH(_srEnableRegister, _srEnableBit);
       delayMicroseconds (1);         // enable pulse must be >450ns               
       fio_digitalWrite_SWITCHTO(_srEnableRegister, _srEnableBit, LOW);
    } // end critical section
+#else
+   // The pulse width is a minimum, only the edges need to be atomic
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_digitalWrite_HIGH(_srEnableRegister, _srEnableBit);
+   }
+   delayMicroseconds (1);         // enable pulse must be >450ns               
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_digitalWrite_SWITCHTO(_srEnableRegister, _srEnableBit, LOW);
+   }
+#endif
 }
 
 // PUBLIC METHODS
@@ -81,7 +81,7 @@ uint8_t LiquidCrystal_SR1W::clearSR()
 	// This also triggers the EN pin because of the falling edge.
 	SR1W_DELAY();
    
-	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
 		// Pre-calculate these values for extra performance and to make sure the clock pulse is as quick as possible
 		fio_bit reg_val = *srRegister;
@@ -134,7 +134,7 @@ uint8_t LiquidCrystal_SR1W::loadSR(uint8_t val)
          
 			previousBit = 1;
          
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 			{
 				// Pre-calculate these values to make sure the clock pulse is as quick as possible
 				fio_bit reg_val = *srRegister;
@@ -247,6 +247,16 @@ void LiquidCrystal_SR1W::setBacklight ( uint8_t value )
 		_blMask = 0;
 	}
    
+	if ( !deferBacklight () )
+	{
+		writeBacklight ();
+	}
+}
+
+//
+// writeBacklight
+void LiquidCrystal_SR1W::writeBacklight ( void )
+{
 	// Send a dummy (non-existant) command to allow the backlight PIN to be latched.
 	// The seems to be safe because the LCD appears to treat this as a NOP.
 	send(0, COMMAND);
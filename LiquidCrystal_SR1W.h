@@ -292,8 +292,8 @@
 #define SR1W_RS_MASK		0x40
 #define SR1W_EN_MASK		0x80	// This cannot be changed. It has to be the first thing shifted in.
 
-#define SR1W_ATOMIC_WRITE_LOW(reg, mask)	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg &= ~mask; }
-#define SR1W_ATOMIC_WRITE_HIGH(reg, mask)	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg |= mask; }
+#define SR1W_ATOMIC_WRITE_LOW(reg, mask)	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg &= ~mask; }
+#define SR1W_ATOMIC_WRITE_HIGH(reg, mask)	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg |= mask; }
 
 
 typedef enum { SW_CLEAR, HW_CLEAR } t_sr1w_circuitType;
@@ -343,6 +343,13 @@ public:
    
 private:
    
+   /*!
+    @method     
+    @abstract   Writes the backlight state.
+    @discussion Latches the backlight line with a dummy command, @see LCD::setBacklightLatency.
+    */
+   virtual void writeBacklight();
+   
    /*!
     @method     
     @abstract   Initializes the LCD pin allocation
@@ -72,12 +72,25 @@ void LiquidCrystal_SR2W::loadSR(uint8_t val)
    
  	
 	// strobe LCD enable which can now be toggled by the data line
-	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#if (FIO_MASKED_HOLD_US >= 1)
+	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
 		fio_digitalWrite_HIGH(_srDataRegister, _srDataMask);
 		waitUsec (1);         // enable pulse must be >450ns               
 		fio_digitalWrite_SWITCHTO(_srDataRegister, _srDataMask, LOW);
 	} // end critical section
+#else
+	// The pulse width is a minimum, only the edges need to be atomic
+	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		fio_digitalWrite_HIGH(_srDataRegister, _srDataMask);
+	}
+	waitUsec (1);         // enable pulse must be >450ns               
+	FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		fio_digitalWrite_SWITCHTO(_srDataRegister, _srDataMask, LOW);
+	}
+#endif
 }
 
 // PUBLIC METHODS
@@ -128,6 +141,16 @@ void LiquidCrystal_SR2W::setBacklight ( uint8_t value )
 		_blMask = 0;
 	}
    
+	if ( !deferBacklight () )
+	{
+		writeBacklight ();
+	}
+}
+
+//
+// writeBacklight
+void LiquidCrystal_SR2W::writeBacklight ( void )
+{
 	// send dummy data of blMask to set BL pin
 	// Note: loadSR() will strobe the data line trying to pulse EN
 	// but E will not strobe because the EN output bit is not set.
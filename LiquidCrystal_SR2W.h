@@ -178,6 +178,13 @@ public:
    
 private:
    
+   /*!
+    @method     
+    @abstract   Writes the backlight state.
+    @discussion Loads the backlight line in the shift register, @see LCD::setBacklightLatency.
+    */
+   virtual void writeBacklight();
+   
    /*!
     @method     
     @abstract   Initializes the LCD pin allocation
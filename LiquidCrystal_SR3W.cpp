@@ -64,7 +64,6 @@
 //                        
 // @author F. Malpartida - fmalpartida@gmail.com
 // ---------------------------------------------------------------------------
-// flags for backlight control
 #include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
@@ -78,20 +77,6 @@
 
 #include "FastIO.h"
 
-/*!
- @defined 
- @abstract   LCD_NOBACKLIGHT
- @discussion No BACKLIGHT MASK
- */
-#define LCD_NOBACKLIGHT 0x00
-
-/*!
- @defined 
- @abstract   LCD_BACKLIGHT
- @discussion BACKLIGHT MASK used when backlight is on
- */
-#define LCD_BACKLIGHT   0xFF
-
 
 // Default library configuration parameters used by class constructor with
 // only the I2C address field.
@@ -162,11 +147,7 @@ LiquidCrystal_SR3W::LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe
 void LiquidCrystal_SR3W::send(uint8_t value, uint8_t mode)
 {
    
-   if ( mode != FOUR_BITS )
-   {
-      write4bits( (value >> 4), mode ); // upper nibble
-   }   
-   write4bits( (value & 0x0F), mode); // lower nibble
+   LCDPort::send ( value, mode );
 
 
 #if (F_CPU <= 16000000)
@@ -180,39 +161,18 @@ void LiquidCrystal_SR3W::send(uint8_t value, uint8_t mode)
 }
 
 
-void LiquidCrystal_SR3W::setBacklightPin ( uint8_t value, t_backlighPol pol = POSITIVE )
-{
-   _backlightPinMask = ( 1 << value );
-   _backlightStsMask = LCD_NOBACKLIGHT;
-   _polarity = pol;
-   setBacklight (BACKLIGHT_OFF);     // Set backlight to off as initial setup
-}
+// PRIVATE METHODS
+// -----------------------------------------------------------------------------
 
-void LiquidCrystal_SR3W::setBacklight ( uint8_t value )
+void LiquidCrystal_SR3W::sendBulk(const uint8_t *data, uint8_t len)
 {
-   // Check if backlight is available
-   // ----------------------------------------------------
-   if ( _backlightPinMask != 0x0 )
+   // The LCDPort transfers would skip the execution wait of send
+   while ( len-- > 0 )
    {
-      // Check for polarity to configure mask accordingly
-      // ----------------------------------------------------------
-      if  (((_polarity == POSITIVE) && (value > 0)) || 
-           ((_polarity == NEGATIVE ) && ( value == 0 )))
-      {
-         _backlightStsMask = _backlightPinMask & LCD_BACKLIGHT;
-      }
-      else 
-      {
-         _backlightStsMask = _backlightPinMask & LCD_NOBACKLIGHT;
-      }
-      loadSR( _backlightStsMask );
+      send ( *data++, LCD_DATA );
    }
 }
 
-
-// PRIVATE METHODS
-// -----------------------------------------------------------------------------
-
 int LiquidCrystal_SR3W::init(uint8_t data, uint8_t clk, uint8_t strobe, 
                              uint8_t Rs, uint8_t Rw, uint8_t En,
                              uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
@@ -225,47 +185,20 @@ int LiquidCrystal_SR3W::init(uint8_t data, uint8_t clk, uint8_t strobe,
    _strobe_reg = fio_pinToOutputRegister(strobe);
    
    // LCD pin mapping
-   _backlightPinMask = 0;
-   _backlightStsMask = LCD_NOBACKLIGHT;
-   _polarity = POSITIVE;
-   
-   _En = ( 1 << En );
-   _Rw = ( 1 << Rw );
-   _Rs = ( 1 << Rs );
-   
-   // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );
+   mapPins ( En, Rw, Rs, d4, d5, d6, d7 );
    
    _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
    
    return (1);
 }
 
-void LiquidCrystal_SR3W::write4bits(uint8_t value, uint8_t mode)
+bool LiquidCrystal_SR3W::portWrite(const uint8_t *values, uint8_t len)
 {
-   uint8_t pinMapValue = 0;
-   
-   // Map the value to LCD pin mapping
-   // --------------------------------
-   for ( uint8_t i = 0; i < 4; i++ )
+   while ( len-- > 0 )
    {
-      if ( ( value & 0x1 ) == 1 )
-      {
-         pinMapValue |= _data_pins[i];
-      }
-      value = ( value >> 1 );
+      loadSR ( *values++ );
    }
-   
-   // Is it a command or data
-   // -----------------------
-   mode = ( mode == LCD_DATA ) ? _Rs : 0;
-   
-   pinMapValue |= mode | _backlightStsMask;
-   loadSR ( pinMapValue | _En );  // Send with enable high
-   loadSR ( pinMapValue); // Send with enable low
+   return ( true );
 }
 
 
@@ -275,7 +208,7 @@ void LiquidCrystal_SR3W::loadSR(uint8_t value)
    fio_shiftOut(_data_reg, _data, _clk_reg, _clk, value, MSBFIRST);
    
    // Strobe the data into the latch
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
    {
       fio_digitalWrite_HIGH(_strobe_reg, _strobe);
       fio_digitalWrite_SWITCHTO(_strobe_reg, _strobe, LOW);
@@ -59,11 +59,11 @@
 #define _LIQUIDCRYSTAL_SR3W_H_
 
 #include <inttypes.h>
-#include "LCD.h"
+#include "LCDPort.h"
 #include "FastIO.h"
 
 
-class LiquidCrystal_SR3W : public LCD 
+class LiquidCrystal_SR3W : public LCDPort
 {
 public:
    
@@ -122,7 +122,7 @@ public:
     @function
     @abstract   Send a particular value to the LCD.
     @discussion Sends a particular value to the LCD for writing to the LCD or
-    as an LCD command.
+    as an LCD command and waits for the LCD to execute it.
     
     Users should never call this method.
     
@@ -132,30 +132,15 @@ public:
     */
    virtual void send(uint8_t value, uint8_t mode);
    
-   /*!
-    @function
-    @abstract   Sets the pin to control the backlight.
-    @discussion Sets the pin in the device to control the backlight. This device
-    doesn't support dimming backlight capability.
-    
-    @param      value: pin mapped on the 74HC595N (0, .., 7) for (Qa0, .., Qh7)
-    respectively.
-    @param      pol: polarity POSITIVE|NEGATIVE.
-    */
-   void setBacklightPin ( uint8_t value, t_backlighPol pol );
+private:
    
    /*!
     @function
-    @abstract   Switch-on/off the LCD backlight.
-    @discussion Switch-on/off the LCD backlight.
-    The setBacklightPin has to be called before setting the backlight for
-    this method to work. @see setBacklightPin.
-    
-    @param      value: backlight mode (HIGH|LOW)
+    @abstract   Send data to the LCD.
+    @discussion Every character goes through send, which waits for the LCD
+    to execute it. @see LCD::sendBulk
     */
-   void setBacklight ( uint8_t value );
-   
-private:
+   virtual void sendBulk(const uint8_t *data, uint8_t len);
    
    /*!
     @method     
@@ -168,13 +153,10 @@ private:
    
    /*!
     @method     
-    @abstract   Writes an 4 bit value to the LCD.
-    @discussion Writes 4 bits (the least significant) to the LCD control data lines.
-    @param      value[in] Value to write to the LCD
-    @param      more[in]  Value to distinguish between command and data.
-    COMMAND == command, DATA == data.
+    @abstract   Loads values in the shift register.
+    @discussion Each value is shifted and latched in turn. @see LCDPort::portWrite
     */
-   void write4bits(uint8_t value, uint8_t mode);
+   virtual bool portWrite(const uint8_t *values, uint8_t len);
    
    /*!
     @function
@@ -191,12 +173,6 @@ private:
    fio_register _data_reg;         // SR data pin MCU register
    fio_bit      _clk;              // shift register clock pin
    fio_register _clk_reg;          // SR clock pin MCU register
-   uint8_t      _En;               // LCD expander word for enable pin
-   uint8_t      _Rw;               // LCD expander word for R/W pin
-   uint8_t      _Rs;               // LCD expander word for Register Select pin
-   uint8_t      _data_pins[4];     // LCD data lines
-   uint8_t      _backlightPinMask; // Backlight IO pin mask
-   uint8_t      _backlightStsMask; // Backlight status mask
    
 };
 
@@ -0,0 +1,188 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SerLCD.cpp
+// This file implements a driver for the serial (UART) LCD backpacks using
+// the SerLCD command protocol.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LiquidCrystal_SerLCD.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+
+// Prefixes of the protocol, the byte that follows is a parameter
+#define SERLCD_COMMAND     0xFE   // LCD instruction
+#define SERLCD_SETTING     0x7C   // Setting of the backpack
+
+// Backlight setting, 30 levels
+#define SERLCD_BACKLIGHT   0x80
+#define SERLCD_BL_LEVELS   29
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_SerLCD::LiquidCrystal_SerLCD( Stream &port, uint32_t baud )
+{
+   _port     = &port;
+   _byteTime = ( 10000000UL + baud - 1 ) / baud;   // start, 8 data, stop
+   _sentAt   = 0;
+   _backlog  = 0;
+   _hold     = 0;
+   _txHead   = 0;
+   _txCount  = 0;
+   _lastSent = 0;
+   _cursorQueued = false;
+
+   // The backpack times the clear and home, the output is held by the driver
+   _clearExec = 0;
+
+   // No nibbles, the interface of the backpack is set up by the backpack
+   _displayfunction = LCD_8BITMODE | LCD_1LINE | LCD_5x8DOTS;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setBacklight
+void LiquidCrystal_SerLCD::setBacklight ( uint8_t value )
+{
+   queue ( SERLCD_SETTING );
+   queue ( SERLCD_BACKLIGHT + ( ( (uint16_t)value * SERLCD_BL_LEVELS ) / 255 ) );
+   update ();
+}
+
+//
+// update
+uint8_t LiquidCrystal_SerLCD::update ( )
+{
+   while ( ( _txCount > 0 ) && ready () )
+   {
+      transmit ();
+   }
+   return ( _txCount );
+}
+
+//
+// flush
+void LiquidCrystal_SerLCD::flush ( )
+{
+   LCD::flush ();
+   while ( _txCount > 0 )
+   {
+      if ( ready () )
+      {
+         transmit ();
+      }
+   }
+}
+
+// low level data pushing commands
+//----------------------------------------------------------------------------
+
+//
+// send - write either command or data
+void LiquidCrystal_SerLCD::send(uint8_t value, uint8_t mode)
+{
+   if ( mode == LCD_DATA )
+   {
+      queue ( value );
+   }
+   else if ( ( mode == COMMAND ) && ( ( value & 0xE0 ) != LCD_FUNCTIONSET ) )
+   {
+      if ( ( value & LCD_SETDDRAMADDR ) && _cursorQueued )
+      {
+         // Nothing has used the previous position, it is replaced
+         _tx[( _txHead + _txCount - 1 ) % LCD_SERLCD_BUFFER] = value;
+      }
+      else
+      {
+         queue ( SERLCD_COMMAND );
+         queue ( value );
+         _cursorQueued = ( ( value & LCD_SETDDRAMADDR ) != 0 );
+      }
+   }
+   update ();
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// queue
+void LiquidCrystal_SerLCD::queue ( uint8_t value )
+{
+   while ( _txCount == LCD_SERLCD_BUFFER )
+   {
+      if ( ready () )
+      {
+         transmit ();
+      }
+   }
+   _tx[( _txHead + _txCount ) % LCD_SERLCD_BUFFER] = value;
+   _txCount++;
+   _cursorQueued = false;
+}
+
+//
+// transmit
+void LiquidCrystal_SerLCD::transmit ( )
+{
+   unsigned long now     = micros ();
+   unsigned long elapsed = now - _sentAt;
+   uint8_t value = _tx[_txHead];
+   bool    param = ( _lastSent == SERLCD_COMMAND ) ||
+                   ( _lastSent == SERLCD_SETTING );
+
+   _port->write ( value );
+   _txHead = ( _txHead + 1 ) % LCD_SERLCD_BUFFER;
+   _txCount--;
+   if ( _txCount < 2 )
+   {
+      _cursorQueued = false;   // The position is on its way
+   }
+
+   // Line time still to go, the backpack receives the byte at its end
+   _backlog = ( ( elapsed < _backlog ) ? _backlog - elapsed : 0 ) + _byteTime;
+   _sentAt  = now;
+
+   // Clear, home and the settings of the backpack hold the output
+   _hold = 0;
+   if ( param && ( ( _lastSent == SERLCD_SETTING ) || ( ( value & 0xFC ) == 0 ) ) )
+   {
+      _hold = _backlog + LCD_SERLCD_SLOW_EXEC;
+   }
+
+   // A parameter is never the prefix of the next byte
+   _lastSent = param ? 0 : value;
+}
+
+//
+// ready
+bool LiquidCrystal_SerLCD::ready ( )
+{
+   unsigned long elapsed = micros () - _sentAt;
+
+   return ( ( elapsed >= _hold ) &&
+            ( elapsed + ( LCD_SERLCD_AHEAD * _byteTime ) > _backlog ) );
+}
@@ -0,0 +1,183 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SerLCD.h
+// This file implements a driver for the serial (UART) LCD backpacks using
+// the SerLCD command protocol.
+//
+// @brief
+// The backpack drives the LCD and takes its commands from a serial line:
+// characters are written as they are, LCD instructions are preceded by 0xFE
+// and the settings of the backpack (backlight) by 0x7C. The driver writes
+// through any Stream (HardwareSerial, SoftwareSerial, ...), started by the
+// application at the baud rate of the backpack.
+//
+// The output is kept in a buffer of the driver and released to the serial
+// port at the rate of the serial line, so that the UART never fills up and
+// print never waits for it. The clear and home instructions and the settings
+// hold the output while the backpack executes them. Every call to the LCD
+// hands over what the line can take at that moment, update has to be called
+// from loop to move the rest along. print only waits when the buffer of the
+// driver is full. A cursor position waiting in the buffer is replaced by the
+// next one.
+//
+// The backpack initialises the LCD, the function set of the library is not
+// forwarded and the backpack has to be configured for the size of the LCD.
+// The characters 0x7C and 0xFE can't be displayed. The LCD can't be read.
+//
+// extras/serlcd_decode.py stands in for the backpack on a PC: it decodes the
+// output of the driver and checks its timing against the serial line.
+//
+// Usage:
+//    LiquidCrystal_SerLCD lcd(Serial1);
+//    Serial1.begin(9600);
+//    lcd.begin(16, 2);
+//    ...
+//    lcd.update();   // in loop
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef LiquidCrystal_SerLCD_h
+#define LiquidCrystal_SerLCD_h
+#include <inttypes.h>
+#include <Stream.h>
+
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Size of the output buffer.
+ @discussion Number of bytes of the output buffer of the driver: a full line
+ of text and the commands positioning it.
+ */
+#ifndef LCD_SERLCD_BUFFER
+#define LCD_SERLCD_BUFFER      48
+#endif
+
+/*!
+ @defined
+ @abstract   Bytes ahead of the serial line.
+ @discussion Maximum number of bytes handed to the serial port that the line
+ hasn't sent yet, it has to fit in the transmit buffer of the port.
+ */
+#ifndef LCD_SERLCD_AHEAD
+#define LCD_SERLCD_AHEAD       16
+#endif
+
+/*!
+ @defined
+ @abstract   Execution time of the slow commands of the backpack.
+ @discussion Time in microseconds the output is held after a clear, a home
+ or a setting of the backpack, stored in its EEPROM.
+ */
+#ifndef LCD_SERLCD_SLOW_EXEC
+#define LCD_SERLCD_SLOW_EXEC   5000
+#endif
+
+class LiquidCrystal_SerLCD : public LCD
+{
+public:
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Initializes class variables. The constructor does not
+    initialize the LCD nor the serial port.
+
+    @param      port[in] serial port connected to the backpack.
+    @param      baud[in] baud rate of the serial port.
+    */
+   LiquidCrystal_SerLCD (Stream &port, uint32_t baud = 9600);
+
+   /*!
+    @function
+    @abstract   Send a particular value to the LCD.
+    @discussion Queues a value for the LCD in the output buffer, as a
+    character or as an LCD instruction.
+
+    Users should never call this method.
+
+    @param      value[in] Value to send to the LCD.
+    @param      mode[in] LCD_DATA - write to the LCD DDRAM or CGRAM, COMMAND -
+    write a command to the LCD.
+    */
+   virtual void send(uint8_t value, uint8_t mode);
+
+   /*!
+    @function
+    @abstract   Switch-on/off the LCD backlight.
+    @discussion Sets the brightness of the backlight, the backpack has 30
+    levels and keeps the setting across power cycles.
+
+    @param      value: backlight value. 0: off, 255: full brightness.
+    */
+   void setBacklight ( uint8_t value );
+
+   /*!
+    @function
+    @abstract   Moves the output along.
+    @discussion Hands to the serial port the bytes of the output buffer the
+    serial line can take, without waiting. It has to be called periodically,
+    at least once per LCD_SERLCD_AHEAD bytes of serial line time to use all
+    the bandwidth of the line (16ms at 9600 baud).
+
+    @result     number of bytes still in the output buffer.
+    */
+   uint8_t update();
+
+   /*!
+    @function
+    @abstract   Executes all the pending output.
+    @discussion Blocks until the output buffer is empty. @see LCD::flush
+    */
+   virtual void flush();
+
+private:
+
+   /*!
+    @function
+    @abstract   Queues a byte in the output buffer.
+    @discussion Waits for room in the buffer if it is full.
+
+    @param      value[in] byte of the protocol.
+    */
+   void queue(uint8_t value);
+
+   /*!
+    @function
+    @abstract   Hands a byte to the serial port.
+    @discussion Sends the oldest byte of the output buffer and accounts for
+    the serial line time and the execution time of the backpack.
+    */
+   void transmit();
+
+   /*!
+    @function
+    @abstract   Checks if the serial port can take a byte.
+    @result     true if the next byte can be sent now.
+    */
+   bool ready();
+
+   Stream  *_port;                // Serial port of the backpack
+   unsigned long _byteTime;       // Serial line time of a byte (us)
+   unsigned long _sentAt;         // Time of the last byte sent
+   unsigned long _backlog;        // Line time of the bytes not sent at _sentAt
+   unsigned long _hold;           // Output held from _sentAt, slow commands
+   uint8_t  _tx[LCD_SERLCD_BUFFER]; // Output buffer
+   uint8_t  _txHead;              // Oldest byte of the output buffer
+   uint8_t  _txCount;             // Number of bytes in the output buffer
+   uint8_t  _lastSent;            // Last byte sent, prefix of the next one
+   bool     _cursorQueued;        // Output buffer ends in a cursor position
+};
+
+#endif
@@ -0,0 +1,132 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SharedBus.cpp
+// This file implements a parallel LCD driver for several LCDs sharing the
+// same data bus.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include <inttypes.h>
+#include "LiquidCrystal_SharedBus.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_SharedBus::LiquidCrystal_SharedBus(uint8_t rs, uint8_t enable,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7) :
+   LiquidCrystal ( rs, enable, d0, d1, d2, d3, d4, d5, d6, d7 )
+{
+   _sentAt = micros ();
+}
+
+LiquidCrystal_SharedBus::LiquidCrystal_SharedBus(uint8_t rs, uint8_t rw,
+                             uint8_t enable,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7) :
+   LiquidCrystal ( rs, rw, enable, d0, d1, d2, d3, d4, d5, d6, d7 )
+{
+   _sentAt = micros ();
+}
+
+LiquidCrystal_SharedBus::LiquidCrystal_SharedBus(uint8_t rs, uint8_t rw,
+                             uint8_t enable,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3) :
+   LiquidCrystal ( rs, rw, enable, d0, d1, d2, d3 )
+{
+   _sentAt = micros ();
+}
+
+LiquidCrystal_SharedBus::LiquidCrystal_SharedBus(uint8_t rs, uint8_t enable,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3) :
+   LiquidCrystal ( rs, enable, d0, d1, d2, d3 )
+{
+   _sentAt = micros ();
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// printAll
+void LiquidCrystal_SharedBus::printAll(LiquidCrystal_SharedBus *lcd[],
+                                       uint8_t numLcds, const char *str[])
+{
+   uint8_t done[( 0xFF + 7 ) / 8];   // One bit per LCD: string written
+   bool    pending = true;
+
+   for ( uint8_t i = 0; i < numLcds; i++ )
+   {
+      if ( ( i & 0x7 ) == 0 )
+      {
+         done[i >> 3] = 0;
+      }
+      if ( str[i] == NULL )
+      {
+         done[i >> 3] |= ( 1 << ( i & 0x7 ) );
+      }
+   }
+
+   for ( size_t pos = 0; pending; pos++ )
+   {
+      pending = false;
+      for ( uint8_t i = 0; i < numLcds; i++ )
+      {
+         if ( done[i >> 3] & ( 1 << ( i & 0x7 ) ) )
+         {
+            continue;
+         }
+         if ( str[i][pos] == '\0' )
+         {
+            done[i >> 3] |= ( 1 << ( i & 0x7 ) );
+         }
+         else
+         {
+            lcd[i]->write ( str[i][pos] );
+            pending = true;
+         }
+      }
+   }
+}
+
+// PROTECTED METHODS
+// ---------------------------------------------------------------------------
+
+//
+// busyWait
+void LiquidCrystal_SharedBus::busyWait()
+{
+#ifndef FAST_MODE
+   unsigned long elapsed = micros () - _sentAt;
+
+   if ( elapsed < EXEC_TIME )
+   {
+      delayMicroseconds ( EXEC_TIME - elapsed );
+   }
+#endif
+}
+
+//
+// execWait
+void LiquidCrystal_SharedBus::execWait()
+{
+   _sentAt = micros ();
+}
@@ -0,0 +1,108 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SharedBus.h
+// This file implements a parallel LCD driver for several LCDs sharing the
+// same data bus.
+//
+// @brief
+// Several LCDs can share the RS, RW and data lines (D4..D7 or D0..D7) of the
+// parallel interface, each LCD having its own enable (EN) line: only the LCD
+// whose enable line is pulsed takes the data from the bus. An object of this
+// class is created per LCD with the same bus pins and its own enable pin.
+//
+// Instead of waiting for every command to execute after sending it, the
+// driver records when each LCD will be ready and only waits, if needed,
+// before the next transfer to that same LCD. While an LCD executes a command
+// the bus is free to load the next one: writing to the LCDs in turn
+// (@see printAll) overlaps their execution times, giving close to N times
+// the throughput of a single LCD.
+//
+// All the LCDs of a bus have to use the same interface width (4 or 8 bits).
+// The LCDs can be initialised together with LCD::beginAll.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef LiquidCrystal_SharedBus_h
+#define LiquidCrystal_SharedBus_h
+
+#include <inttypes.h>
+#include "LiquidCrystal.h"
+
+class LiquidCrystal_SharedBus : public LiquidCrystal
+{
+public:
+   /*!
+    @method
+    @abstract   8 bit LCD constructors.
+    @discussion Defines the pin assignment of an LCD of the bus, all the LCDs
+    of the bus have the same rs, rw and data pins.
+    The constructor does not initialize the LCD.
+    */
+   LiquidCrystal_SharedBus(uint8_t rs, uint8_t enable,
+                           uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                           uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+   LiquidCrystal_SharedBus(uint8_t rs, uint8_t rw, uint8_t enable,
+                           uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                           uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+
+   /*!
+    @method
+    @abstract   4 bit LCD constructors.
+    @discussion Defines the pin assignment of an LCD of the bus, all the LCDs
+    of the bus have the same rs, rw and data pins.
+    The constructor does not initialize the LCD.
+    */
+   LiquidCrystal_SharedBus(uint8_t rs, uint8_t rw, uint8_t enable,
+                           uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);
+   LiquidCrystal_SharedBus(uint8_t rs, uint8_t enable,
+                           uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);
+
+   /*!
+    @function
+    @abstract   Prints a string on each LCD of a bus.
+    @discussion Writes the strings interleaving the characters: the first
+    character of every string, then the second one, ... so that every LCD
+    executes while the rest are loaded. The strings are written at the
+    current cursor position of each LCD, they don't need to be the same
+    length.
+
+    @param      lcd[in] LCDs sharing the bus.
+    @param      numLcds[in] number of LCDs.
+    @param      str[in] string to print on each LCD (NULL for none).
+    */
+   static void printAll(LiquidCrystal_SharedBus *lcd[], uint8_t numLcds,
+                        const char *str[]);
+
+protected:
+   /*!
+    @method
+    @abstract   Waits for the LCD to be ready for a transfer.
+    @discussion Waits until the previous command sent to this LCD has been
+    executed.
+    */
+   virtual void busyWait();
+
+   /*!
+    @method
+    @abstract   Records the execution of a transfer.
+    @discussion Records when the LCD will have executed the command instead
+    of waiting for it.
+    */
+   virtual void execWait();
+
+private:
+   unsigned long _sentAt;   // Time of the last transfer to the LCD (us)
+};
+
+#endif
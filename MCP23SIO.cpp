@@ -0,0 +1,168 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file MCP23SIO.cpp
+// This file implements a basic IO library using the MCP23S08 and MCP23S17
+// SPI IO expanders.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+   #include <WProgram.h>
+#else
+   #include <Arduino.h>
+#endif
+
+#include <SPI.h>
+#include <inttypes.h>
+
+#include "MCP23SIO.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+#define MCP23S_WRITE      0x40   // Write opcode, hardware address in bits 3..1
+
+// Registers, the MCP23S17 is used with IOCON.BANK = 0 (reset state)
+#define MCP23S08_IOCON    0x05
+#define MCP23S08_OLAT     0x0A
+#define MCP23S17_IOCON    0x0A
+#define MCP23S17_OLATA    0x14
+#define MCP23S_IODIR      0x00   // IODIR (MCP23S08), IODIRA (MCP23S17)
+
+// IOCON: byte mode (no address increment) and hardware address enabled. On
+// the MCP23S17 byte mode toggles between the registers of port A and B.
+#define MCP23S_IOCON      0x28   // SEQOP | HAEN
+
+// CONSTRUCTOR
+// ---------------------------------------------------------------------------
+MCP23SIO::MCP23SIO ( )
+{
+   _csReg       = 0;
+   _csBit       = 0;
+   _opcode      = MCP23S_WRITE;
+   _olat        = MCP23S08_OLAT;
+   _initialised = false;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+int MCP23SIO::begin ( uint8_t cs, uint8_t hwAddr, bool wide )
+{
+   _csBit  = fio_pinToBit ( cs );
+   _csReg  = fio_pinToOutputRegister ( cs, HIGH );
+   _olat   = wide ? MCP23S17_OLATA : MCP23S08_OLAT;
+
+   SPI.begin ( );
+
+   // Until HAEN is set the devices answer at hardware address 0, all the
+   // devices of the chip select get the same configuration.
+   _opcode = MCP23S_WRITE;
+   writeRegister ( wide ? MCP23S17_IOCON : MCP23S08_IOCON, MCP23S_IOCON, 1 );
+   _opcode = MCP23S_WRITE | ( ( hwAddr & 0x07 ) << 1 );
+
+   // Outputs low, then all the pins as OUTPUT
+   writeRegister ( _olat, 0x00, wide ? 2 : 1 );
+   writeRegister ( MCP23S_IODIR, 0x00, wide ? 2 : 1 );
+
+   _initialised = true;
+   return ( _initialised );
+}
+
+//
+// write
+int MCP23SIO::write ( const uint8_t *values, uint8_t len )
+{
+   if ( !beginBurst ( ) )
+   {
+      return ( 0 );
+   }
+
+   while ( len-- > 0 )
+   {
+      SPI.transfer ( *values++ );
+   }
+   endBurst ( );
+   return ( 1 );
+}
+
+//
+// beginBurst
+int MCP23SIO::beginBurst ( )
+{
+   if ( !_initialised )
+   {
+      return ( 0 );
+   }
+   select ( );
+   return ( 1 );
+}
+
+//
+// burst
+void MCP23SIO::burst ( uint8_t value )
+{
+   SPI.transfer ( value );
+}
+
+//
+// endBurst
+void MCP23SIO::endBurst ( )
+{
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_digitalWrite_HIGH ( _csReg, _csBit );
+   }
+#ifdef SPI_HAS_TRANSACTION
+   SPI.endTransaction ( );
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// select
+void MCP23SIO::select ( )
+{
+#ifdef SPI_HAS_TRANSACTION
+   SPI.beginTransaction ( SPISettings ( MCP23S_CLOCK, MSBFIRST, SPI_MODE0 ) );
+#endif
+   FIO_ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_digitalWrite_LOW ( _csReg, _csBit );
+   }
+   SPI.transfer ( _opcode );
+   SPI.transfer ( _olat );
+}
+
+//
+// writeRegister
+void MCP23SIO::writeRegister ( uint8_t reg, uint8_t value, uint8_t len )
+{
+   uint8_t olat = _olat;
+
+   _olat = reg;
+   select ( );
+   while ( len-- > 0 )
+   {
+      SPI.transfer ( value );
+   }
+   endBurst ( );
+   _olat = olat;
+}
@@ -0,0 +1,142 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file MCP23SIO.h
+// This file implements a basic IO library using the MCP23S08 and MCP23S17
+// SPI IO expanders.
+//
+// @brief
+// Implements the output side of the MCP23S08 (8 bits) and MCP23S17 (16 bits)
+// SPI IO expanders. The expander is configured in byte mode: the register
+// address doesn't advance, all the bytes of a burst (chip select asserted)
+// are written to the output latch, each one updating the outputs. On the
+// MCP23S17 the bytes alternate between the latches of port A and port B.
+//
+// The SPI clock is 10MHz at most, a byte on the bus lasts long enough to
+// drive the LCD enable line directly from the expander outputs.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+
+#ifndef _MCP23SIO_H_
+#define _MCP23SIO_H_
+
+#include <inttypes.h>
+#include "FastIO.h"
+
+/*!
+ @defined
+ @abstract   SPI clock of the expander.
+ @discussion The MCP23S08 and MCP23S17 run up to 10MHz.
+ */
+#ifndef MCP23S_CLOCK
+#define MCP23S_CLOCK   10000000
+#endif
+
+/*!
+ @class
+ @abstract    MCP23SIO
+ @discussion  Library driver to control MCP23S08/MCP23S17 based ASICs.
+ Implementing library calls to write the ports through the SPI bus.
+ */
+
+class MCP23SIO
+{
+public:
+   /*!
+    @method
+    @abstract   Constructor method
+    @discussion Class constructor constructor.
+    */
+   MCP23SIO ( );
+
+   /*!
+    @method
+    @abstract   Initializes the device.
+    @discussion This method initializes the SPI bus and the device: byte mode,
+    hardware addressing and all the pins as OUTPUT. It is the first method
+    that should be called prior to calling any other method from this class.
+
+    @param      cs[in] pin connected to the chip select of the device.
+    @param      hwAddr[in] hardware address of the device (A2..A0 pins), the
+    devices sharing a chip select line are told apart by it.
+    @param      wide[in] true for the MCP23S17 (ports A and B), false for the
+    MCP23S08.
+    @result     1 if the device was initialized correctly, 0 otherwise
+    */
+   int begin ( uint8_t cs, uint8_t hwAddr = 0, bool wide = false );
+
+   /*!
+    @method
+    @abstract   Write values to the device.
+    @discussion Writes the values in a single burst. On the MCP23S17 the
+    values alternate between port A and port B, starting with port A.
+
+    @param      values[in] values to be written to the device.
+    @param      len[in] number of values.
+    @result     1 on success, 0 otherwise
+    */
+   int write ( const uint8_t *values, uint8_t len );
+
+   /*!
+    @method
+    @abstract   Starts a burst.
+    @discussion Asserts the chip select of the device and addresses the
+    output latch. The burst lasts until endBurst, the time between the
+    values written is up to the caller.
+
+    @result     1 if the burst started, 0 if the device is not initialised
+    (endBurst is not called then).
+    */
+   int beginBurst ( );
+
+   /*!
+    @method
+    @abstract   Writes a value in a burst.
+    @param      value[in] value to be written to the device.
+    */
+   void burst ( uint8_t value );
+
+   /*!
+    @method
+    @abstract   Ends a burst.
+    @discussion Releases the chip select of the device.
+    */
+   void endBurst ( );
+
+private:
+   /*!
+    @method
+    @abstract   Selects the device.
+    @discussion Asserts the chip select of the device and addresses the
+    register _olat, released by endBurst.
+    */
+   void select ( );
+
+   /*!
+    @method
+    @abstract   Writes the registers of the device.
+    @param      reg[in] address of the first register.
+    @param      value[in] value written.
+    @param      len[in] number of times the value is written.
+    */
+   void writeRegister ( uint8_t reg, uint8_t value, uint8_t len );
+
+   fio_register _csReg;   // Chip select output register
+   fio_bit  _csBit;       // Chip select bit
+   uint8_t  _opcode;      // Write opcode with the hardware address
+   uint8_t  _olat;        // Address of the output latch
+   bool     _initialised; // Initialised object
+};
+
+#endif
@@ -52,6 +52,7 @@
 
 #include "SI2CIO.h"
 #include "SoftI2CMaster.h"
+#include "I2CScan.h"
 
 
 // CLASS VARIABLES
@@ -144,22 +145,31 @@ uint8_t SI2CIO::read ( void )
 //
 // write
 int SI2CIO::write ( uint8_t value )
+{
+   return ( write ( &value, 1 ) );
+}
+
+//
+// write
+int SI2CIO::write ( const uint8_t *values, uint8_t len )
 {
    int status = 0;
    
    if ( _initialised )
    {
-      // Only write HIGH the values of the ports that have been initialised as
-      // outputs updating the output shadow of the device
-      _shadow = ( value & ~(_dirMask) );
-   
       status = i2c_start(_i2cAddr | I2C_WRITE);
- 
-	  status &= i2c_write(_shadow);
       
-	  i2c_stop();
+      for ( uint8_t i = 0; i < len; i++ )
+      {
+         // Only write HIGH the values of the ports that have been initialised
+         // as outputs updating the output shadow of the device
+         _shadow = ( values[i] & ~(_dirMask) );
+         status &= i2c_write(_shadow);
+      }
+      
+      i2c_stop();
    }
-   return ( (status == 0) );
+   return ( status );
 }
 
 //
@@ -206,7 +216,25 @@ int SI2CIO::digitalWrite ( uint8_t pin, uint8_t level )
    return ( status );
 }
 
+//
+// detect
+uint8_t SI2CIO::detect ( uint8_t hint )
+{
+   i2c_init();
+   return ( i2cScan ( hint, isAvailable ) );
+}
+
 //
 // PRIVATE METHODS
 // ---------------------------------------------------------------------------
+
+//
+// isAvailable
+bool SI2CIO::isAvailable ( uint8_t i2cAddr )
+{
+   bool ack = i2c_start ( ( i2cAddr << 1 ) | I2C_WRITE );
+   
+   i2c_stop ();
+   return ( ack );
+}
 #endif // defined (__AVR__)
@@ -125,6 +125,19 @@ public:
     */   
    int write ( uint8_t value );
    
+   /*!
+    @method
+    @abstract   Write several values to the device.
+    @discussion Writes the values in order in a single I2C transaction, the
+    device updates its outputs after each byte. The values are masked as
+    in write(value).
+    
+    @param      values[in] values to be written to the device.
+    @param      len[in] number of values.
+    @result     1 on success, 0 otherwise
+    */   
+   int write ( const uint8_t *values, uint8_t len );
+   
    /*!
     @method
     @abstract   Writes a digital level to a particular pin.
@@ -138,7 +151,17 @@ public:
     */   
    int digitalWrite ( uint8_t pin, uint8_t level );
    
-   
+   /*!
+    @method
+    @abstract   Finds the address of an expander.
+    @discussion Probes "hint" first, if it is an expander address, and then
+    the PCF8574 (0x20-0x27) and PCF8574A (0x38-0x3F) addresses, most likely
+    first. @see i2cScan
+    
+    @param      hint[in] address to probe first, 0 for none.
+    @result     address of the first device that answers, 0 if none.
+    */
+   static uint8_t detect ( uint8_t hint );
    
 private:
    uint8_t _shadow;      // Shadow output
@@ -146,6 +169,14 @@ private:
    uint8_t _i2cAddr;     // I2C address
    bool    _initialised; // Initialised object
    
+   /*!
+    @method
+    @abstract   Check if I2C device is available.
+    @param      i2cAddr[in] I2C address to check availability 
+    @result     true if available, false otherwise.
+    */   
+   static bool isAvailable ( uint8_t i2cAddr );
+   
 };
 
 #else
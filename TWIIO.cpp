@@ -0,0 +1,189 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file TWIIO.cpp
+// This file implements a non blocking I2C write transport on the TWI
+// hardware of the AVR processors.
+//
+// @brief
+// See the corresponding header file for full details.
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include "TWIIO.h"
+
+#if defined (TWCR)
+
+#include <stddef.h>
+#include <util/twi.h>
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+
+// TWCR values of a transaction, the TWI interrupt (it belongs to Wire) and
+// the acknowledge are disabled until its end
+#define TWI_NEXT   ( _BV(TWINT) | _BV(TWEN) )
+#define TWI_START  ( _BV(TWINT) | _BV(TWEN) | _BV(TWSTA) )
+#define TWI_STOP   ( _BV(TWINT) | _BV(TWEN) | _BV(TWSTO) )
+
+// CONSTRUCTOR
+// ---------------------------------------------------------------------------
+TWIIO::TWIIO ( uint8_t *queue, uint8_t size )
+{
+   _queue  = queue;
+   _size   = size;
+   _head   = 0;
+   _count  = 0;
+   _addr   = 0;
+   _active = false;
+   _idle   = 0;
+   _error  = TWIIO_OK;
+   _done   = NULL;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void TWIIO::begin ( uint8_t i2cAddr )
+{
+   flush ( );
+   _addr = i2cAddr;
+}
+
+//
+// write
+void TWIIO::write ( uint8_t value )
+{
+   while ( _count == _size )
+   {
+      service ( );
+   }
+   _queue[( _head + _count ) % _size] = value;
+   _count++;
+   service ( );
+}
+
+//
+// service
+bool TWIIO::service ( )
+{
+   if ( !_active )
+   {
+      // Start a transaction once the stop of the previous one is on the bus
+      if ( ( _count > 0 ) && !( TWCR & _BV(TWSTO) ) )
+      {
+         _active = true;
+         _idle   = TWCR & ( _BV(TWEA) | _BV(TWIE) );
+         TWCR    = TWI_START;
+      }
+      return ( _count > 0 );
+   }
+
+   if ( !( TWCR & _BV(TWINT) ) )
+   {
+      return ( true );     // The hardware is busy with the last step
+   }
+
+   switch ( TW_STATUS )
+   {
+      case TW_START:
+      case TW_REP_START:
+         TWDR = TW_WRITE | ( _addr << 1 );
+         TWCR = TWI_NEXT;
+         break;
+
+      case TW_MT_SLA_ACK:
+      case TW_MT_DATA_ACK:
+         // The values queued meanwhile continue the transaction
+         if ( _count > 0 )
+         {
+            TWDR  = _queue[_head];
+            _head = ( _head + 1 ) % _size;
+            _count--;
+            TWCR  = TWI_NEXT;
+         }
+         else
+         {
+            end ( TWIIO_OK, true );
+         }
+         break;
+
+      case TW_MT_SLA_NACK:
+         end ( TWIIO_ADDR_NACK, true );
+         break;
+
+      case TW_MT_DATA_NACK:
+         end ( TWIIO_DATA_NACK, true );
+         break;
+
+      case TW_MT_ARB_LOST:
+         // Another master has the bus, it is released without a stop
+         end ( TWIIO_BUS_ERROR, false );
+         break;
+
+      default:
+         end ( TWIIO_BUS_ERROR, true );
+         break;
+   }
+   return ( _active || ( _count > 0 ) );
+}
+
+//
+// flush
+void TWIIO::flush ( )
+{
+   while ( service ( ) );
+   while ( TWCR & _BV(TWSTO) );
+}
+
+//
+// status
+uint8_t TWIIO::status ( )
+{
+   uint8_t error = _error;
+
+   _error = TWIIO_OK;
+   return ( error );
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// end
+void TWIIO::end ( uint8_t status, bool stop )
+{
+   // Wire gets the bus back as it left it
+   TWCR    = ( stop ? TWI_STOP : TWI_NEXT ) | _idle;
+   _active = false;
+
+   if ( status != TWIIO_OK )
+   {
+      // The values left belong to a sequence that has been cut, the device
+      // (LCD) has to be resynchronised anyway.
+      _count = 0;
+      if ( _error == TWIIO_OK )
+      {
+         _error = status;
+      }
+   }
+
+   if ( _done != NULL )
+   {
+      _done ( status );
+   }
+}
+
+#endif // defined (TWCR)
@@ -0,0 +1,181 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file TWIIO.h
+// This file implements a non blocking I2C write transport on the TWI
+// hardware of the AVR processors.
+//
+// @brief
+// The values written to the I2C device are kept in a queue owned by the
+// application and sent by the TWI hardware while the program continues: no
+// wait for the transfer, no copy into the 32 byte buffer of the Wire
+// library. The values queued while a transaction is running extend it, the
+// transaction ends when the queue is empty.
+//
+// The TWI interrupt belongs to the Wire library, the transfer is moved along
+// by service: every write calls it and loop has to call it too, each call
+// takes a few microseconds. A call executes at most one step of the transfer
+// (start, address or one value), so the throughput depends on how often loop
+// calls service: at 100kHz a value takes 90us on the bus, a loop slower than
+// that slows the transfer down. When the queue is full write spins calling
+// service until there is room, the program only continues while the values
+// fit in the queue. The end of a transaction is reported with its status by
+// a callback, the errors are kept for status.
+//
+// The TWI interrupt and acknowledge (TWEA) are disabled during a transaction
+// and restored at its end as Wire left them, Wire keeps working as a slave
+// between transactions.
+//
+// The bus is set up by the Wire library (Wire.begin, Wire.setClock). Wire
+// can be used between transfers, flush waits for the queue to be sent.
+//
+// Usage, as transport of an I2CIO (LiquidCrystal_I2C::setTransport):
+//    uint8_t queue[64];
+//    TWIIO   twi(queue, sizeof(queue));
+//
+// @version API 1.0.0
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _TWIIO_H_
+#define _TWIIO_H_
+
+#include <inttypes.h>
+
+#if defined (__AVR__)
+#include <avr/io.h>
+#endif
+
+#if defined (TWCR)
+
+/*!
+ @defined
+ @abstract   Status of the transfers.
+ @discussion Same values as Wire.endTransmission: success, the device didn't
+ acknowledge its address, the device didn't acknowledge a value, bus error
+ or arbitration lost.
+ */
+#define TWIIO_OK           0
+#define TWIIO_ADDR_NACK    2
+#define TWIIO_DATA_NACK    3
+#define TWIIO_BUS_ERROR    4
+
+/*!
+ @typedef
+ @abstract   End of transaction callback.
+ @discussion Called by service at the end of every transaction.
+ @param      status[in] TWIIO_OK or the error that ended the transaction.
+ */
+typedef void (*t_twiDone)( uint8_t status );
+
+/*!
+ @class
+ @abstract    TWIIO
+ @discussion  Non blocking I2C write transport on the AVR TWI hardware.
+ */
+class TWIIO
+{
+public:
+   /*!
+    @method
+    @abstract   Constructor method
+    @discussion Class constructor.
+
+    @param      queue[in] storage of the queue, owned by the application.
+    @param      size[in] number of bytes of the queue.
+    */
+   TWIIO ( uint8_t *queue, uint8_t size );
+
+   /*!
+    @method
+    @abstract   Sets the device written.
+    @discussion Waits for the values queued to be sent, the next ones go to
+    the new address.
+
+    @param      i2cAddr[in] I2C address of the device.
+    */
+   void begin ( uint8_t i2cAddr );
+
+   /*!
+    @method
+    @abstract   Queues a value for the device.
+    @discussion Starts a transaction if none is running. If the queue is full
+    it waits for room.
+
+    @param      value[in] value to be written to the device.
+    */
+   void write ( uint8_t value );
+
+   /*!
+    @method
+    @abstract   Moves the transfer along.
+    @discussion Executes the next step of the transfer if the TWI hardware is
+    done with the previous one, it never waits.
+
+    @result     true while values are queued or a transaction is running.
+    */
+   bool service ( );
+
+   /*!
+    @method
+    @abstract   Sends all the values queued.
+    @discussion Blocks until the queue is empty and the bus is free.
+    */
+   void flush ( );
+
+   /*!
+    @method
+    @abstract   Values waiting in the queue.
+    @result     number of values queued not yet sent.
+    */
+   uint8_t pending ( ) { return ( _count ); };
+
+   /*!
+    @method
+    @abstract   Status of the transfers.
+    @discussion Returns the first error since the last call, clearing it. The
+    values queued when a transaction fails are dropped.
+
+    @result     TWIIO_OK or the first error.
+    */
+   uint8_t status ( );
+
+   /*!
+    @method
+    @abstract   Sets the end of transaction callback.
+    @param      done[in] function called at the end of every transaction, NULL
+    for none.
+    */
+   void onDone ( t_twiDone done ) { _done = done; };
+
+private:
+   /*!
+    @method
+    @abstract   Ends a transaction.
+    @param      status[in] status of the transaction.
+    @param      stop[in] release the bus with a stop condition.
+    */
+   void end ( uint8_t status, bool stop );
+
+   uint8_t  *_queue;     // Queue storage
+   uint8_t   _size;      // Size of the queue
+   uint8_t   _head;      // Oldest value of the queue
+   uint8_t   _count;     // Number of values queued
+   uint8_t   _addr;      // I2C address of the device
+   bool      _active;    // Transaction running
+   uint8_t   _idle;      // TWEA and TWIE set by Wire, restored at the end
+   uint8_t   _error;     // First error since the last status
+   t_twiDone _done;      // End of transaction callback
+};
+
+#endif // defined (TWCR)
+
+#endif
@@ -0,0 +1,66 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no 
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file CGRAMAnimation.ino
+// Plays a spinner and a battery charge animation using the LCDAnimator.
+// 
+// @brief The animations are serviced from the main loop with a time budget
+// of 1ms per call, the rest of the loop (here a counter) keeps running while
+// the glyphs are updated.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <Wire.h>
+#include <LiquidCrystal_I2C.h>
+#include <LCDAnimator.h>
+
+LiquidCrystal_I2C lcd(0x38);  // Set the LCD I2C address
+LCDAnimator       animator(lcd);
+
+const uint8_t spinner[][8] PROGMEM = {
+   { 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },
+   { 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 },
+   { 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 },
+   { 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00 },
+   { 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00 },
+   { 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x00, 0x00 },
+   { 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00 },
+   { 0x00, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 }
+};
+
+const uint8_t battery[][8] PROGMEM = {
+   { 0x0E, 0x1B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F },
+   { 0x0E, 0x1B, 0x11, 0x11, 0x11, 0x11, 0x1F, 0x1F },
+   { 0x0E, 0x1B, 0x11, 0x11, 0x11, 0x1F, 0x1F, 0x1F },
+   { 0x0E, 0x1B, 0x11, 0x11, 0x1F, 0x1F, 0x1F, 0x1F },
+   { 0x0E, 0x1B, 0x11, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+   { 0x0E, 0x1B, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F }
+};
+
+unsigned long counter = 0;
+
+void setup()
+{
+   lcd.begin(16,2);               // initialize the lcd 
+   
+   animator.play ( 0, spinner, sizeof(spinner) / sizeof(spinner[0]), 100 );
+   animator.play ( 1, battery, sizeof(battery) / sizeof(battery[0]), 500 );
+   
+   lcd.home ();
+   lcd.print ( char(0) );
+   lcd.print ( " working " );
+   lcd.print ( char(1) );
+}
+
+void loop()
+{
+   animator.service ( 1000 );     // spend at most 1ms updating the glyphs
+   
+   lcd.setCursor ( 0, 1 );
+   lcd.print ( counter++ );
+}
@@ -0,0 +1,56 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file HelloWorld_SerLCD.ino
+// Drives a SerLCD serial backpack connected to Serial1 at 9600 baud.
+//
+// @brief The driver buffers the output and releases it at the rate of the
+// serial line, loop calls update to move it along. The time spent in the
+// LCD calls is reported on Serial: it stays far below the time the serial
+// line takes to carry the text. The timing of the serial line itself is
+// checked on a PC with extras/serlcd_decode.py, in place of the backpack.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <LiquidCrystal_SerLCD.h>
+
+LiquidCrystal_SerLCD lcd ( Serial1, 9600 );
+
+unsigned long lastUpdate;
+
+void setup()
+{
+   Serial.begin ( 115200 );
+   Serial1.begin ( 9600 );
+
+   lcd.begin ( 16, 2 );
+   lcd.print ( "Hello, world!" );
+   lcd.flush ( );
+}
+
+void loop()
+{
+   char          line[17];
+   unsigned long spent;
+
+   lcd.update ( );
+
+   if ( millis () - lastUpdate >= 250 )
+   {
+      lastUpdate = millis ();
+
+      spent = micros ();
+      snprintf ( line, sizeof(line), "%-16lu", lastUpdate );
+      lcd.setCursor ( 0, 1 );
+      lcd.print ( line );
+      spent = micros () - spent;
+
+      Serial.print ( "LCD calls (us): " );
+      Serial.println ( spent );
+   }
+}
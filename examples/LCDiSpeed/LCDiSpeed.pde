@@ -174,6 +174,9 @@ char buf[8];
 	 * Time an FPS test
 	 */
 
+#ifdef FIO_MASK_PROBE
+	fio_maskStatsReset();
+#endif
 	etime = timeFPS(FPS_iter, LCD_COLS, LCD_ROWS);
 
 	/*
@@ -181,6 +184,13 @@ char buf[8];
 	 */
 	showByteXfer(etime);
 
+#ifdef FIO_MASK_PROBE
+	/*
+	 * show the interrupts masked time during the FPS test
+	 */
+	showMasked();
+#endif
+
 	/*
 	 * show FPS rate and Frame update time for this display
 	 */
@@ -279,3 +289,27 @@ void showByteXfer(unsigned long etime)
 
 	delay(DELAY_TIME);
 }
+#ifdef FIO_MASK_PROBE
+void showMasked()
+{
+fio_maskStats_t stats;
+
+	fio_maskStats(&stats);
+	lcd.clear();
+	lcd.print("IRQoff: ");
+	lcd.print(stats.maxCycles);
+	if(LCD_ROWS > 1)
+	{
+		lcd.setCursor(0,1);
+	}
+	else
+	{
+		delay(DELAY_TIME);
+		lcd.clear();
+	}
+	lcd.print("avg: ");
+	lcd.print(stats.count ? stats.totalCycles / stats.count : 0);
+
+	delay(DELAY_TIME);
+}
+#endif
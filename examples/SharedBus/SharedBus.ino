@@ -0,0 +1,49 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no 
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file SharedBus.ino
+// Drives three LCDs sharing RS and D4..D7 with an enable pin each.
+// 
+// @brief The LCDs are initialised together with LCD::beginAll and written
+// with printAll, which interleaves the characters so that every LCD executes
+// while the others are loaded.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <LiquidCrystal_SharedBus.h>
+
+//                          RS  EN  D4  D5  D6  D7
+LiquidCrystal_SharedBus lcd1(12, 11,  5,  4,  3,  2);
+LiquidCrystal_SharedBus lcd2(12, 10,  5,  4,  3,  2);
+LiquidCrystal_SharedBus lcd3(12,  9,  5,  4,  3,  2);
+
+LiquidCrystal_SharedBus *panel[] = { &lcd1, &lcd2, &lcd3 };
+LCD                     *display[] = { &lcd1, &lcd2, &lcd3 };
+
+void setup()
+{
+   const char *title[] = { "Rack 1", "Rack 2", "Rack 3" };
+   
+   LCD::beginAll ( display, 3, 16, 2 );
+   LiquidCrystal_SharedBus::printAll ( panel, 3, title );
+}
+
+void loop()
+{
+   char        line[3][17];
+   const char *text[3];
+   
+   for ( uint8_t i = 0; i < 3; i++ )
+   {
+      snprintf ( line[i], sizeof(line[i]), "%-16lu", millis () / ( i + 1 ) );
+      text[i] = line[i];
+      panel[i]->setCursor ( 0, 1 );
+   }
+   LiquidCrystal_SharedBus::printAll ( panel, 3, text );
+   delay ( 100 );
+}
@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+# ---------------------------------------------------------------------------
+# Created by Francisco Malpartida on 18/10/26.
+# Copyright 2026 - Under creative commons license 3.0:
+#        Attribution-ShareAlike CC BY-SA
+#
+# This software is furnished "as is", without technical support, and with no
+# warranty, express or implied, as to its usefulness for any purpose.
+#
+# @file serlcd_decode.py
+# Host side decoder of the output of LiquidCrystal_SerLCD.
+#
+# @brief
+# Stands in for the SerLCD backpack: reads the serial stream the driver
+# produces, decodes the frames of the protocol (0xFE LCD instruction, 0x7C
+# backpack setting, characters) with their arrival time and checks the timing
+# of the driver against a model of the serial line:
+#    - bytes ahead: bytes handed over that the line at the given baud rate
+#      wouldn't have sent yet (has to stay within LCD_SERLCD_AHEAD),
+#    - hold: time between the end of a clear, home or setting on the line and
+#      the next byte (has to be at least LCD_SERLCD_SLOW_EXEC).
+# At the end it reports the throughput, the violations and the contents of
+# the emulated display. The exit status is 1 if there were violations.
+#
+# Usage:
+#    serlcd_decode.py /dev/ttyUSB0        the backpack replaced by a USB serial
+#                                         adapter (its latency blurs the times)
+#    serlcd_decode.py --idle 1            creates a pty and prints its name, a
+#                                         host build of the driver writes to it
+#    options: -b baud, -c cols, -r rows, --ahead bytes, --hold us,
+#             --jitter ms, --idle s (stop after s seconds without data, else
+#             Ctrl-C), -q (summary only)
+# The stream is captured first and decoded when the capture ends. The reads
+# are stamped when the host schedules the decoder, the checks allow for
+# --jitter (0.5ms by default, raise it for USB serial adapters).
+#
+# @author F. Malpartida - fmalpartida@gmail.com
+# ---------------------------------------------------------------------------
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+SERLCD_COMMAND = 0xFE
+SERLCD_SETTING = 0x7C
+SERLCD_BACKLIGHT = 0x80
+SERLCD_BL_LEVELS = 29
+
+ROW_OFFSETS = (0x00, 0x40, 0x14, 0x54)
+
+BAUDS = {
+    2400: termios.B2400, 4800: termios.B4800, 9600: termios.B9600,
+    19200: termios.B19200, 38400: termios.B38400, 57600: termios.B57600,
+    115200: termios.B115200,
+}
+
+
+class Display:
+    """HD44780 DDRAM model, enough to show what the driver has drawn."""
+
+    def __init__(self, cols, rows):
+        self.cols = cols
+        self.rows = rows
+        self.clear()
+
+    def clear(self):
+        self.ddram = bytearray(b' ' * 0x80)
+        self.addr = 0
+
+    def put(self, value):
+        self.ddram[self.addr & 0x7F] = value
+        self.addr = (self.addr + 1) & 0x7F
+
+    def screen(self):
+        lines = []
+        for row in range(self.rows):
+            start = ROW_OFFSETS[row]
+            text = self.ddram[start:start + self.cols]
+            lines.append('|' + ''.join(chr(c) if 32 <= c < 127 else '?'
+                                       for c in text) + '|')
+        return lines
+
+
+def position(addr, cols, rows):
+    """Column and row of a DDRAM address."""
+    for row in range(rows):
+        if ROW_OFFSETS[row] <= addr < ROW_OFFSETS[row] + cols:
+            return addr - ROW_OFFSETS[row], row
+    return addr, 0
+
+
+def instruction(value, cols, rows):
+    """Description of an LCD instruction, and whether the backpack holds."""
+    if value == 0x01:
+        return 'clear', True
+    if value & 0xFE == 0x02:
+        return 'home', True
+    if value & 0x80:
+        col, row = position(value & 0x7F, cols, rows)
+        return 'setCursor (%d, %d)' % (col, row), False
+    if value & 0x40:
+        return 'CGRAM address 0x%02X' % (value & 0x3F), False
+    if value & 0x20:
+        return 'function set 0x%02X' % value, False
+    if value & 0x10:
+        return '%s shift %s' % ('display' if value & 0x08 else 'cursor',
+                                'right' if value & 0x04 else 'left'), False
+    if value & 0x08:
+        return 'display %s, cursor %s, blink %s' % (
+            'on' if value & 0x04 else 'off', 'on' if value & 0x02 else 'off',
+            'on' if value & 0x01 else 'off'), False
+    if value & 0x04:
+        return 'entry mode 0x%02X' % value, False
+    return 'instruction 0x%02X' % value, False
+
+
+def setting(value):
+    """Description of a backpack setting."""
+    if SERLCD_BACKLIGHT <= value <= SERLCD_BACKLIGHT + SERLCD_BL_LEVELS:
+        level = (value - SERLCD_BACKLIGHT) * 100 // SERLCD_BL_LEVELS
+        return 'backlight %d%%' % level
+    return 'setting 0x%02X' % value
+
+
+class Decoder:
+    """Splits the stream in frames and checks it against the line model."""
+
+    def __init__(self, args):
+        self.args = args
+        self.byte_time = 10.0 / args.baud   # start, 8 data, stop
+        self.jitter = args.jitter / 1000.0  # Time stamp jitter of the capture
+        self.display = Display(args.cols, args.rows)
+        self.start = None
+        self.last = None
+        self.line_free = 0.0        # Time the line has sent all the bytes
+        self.prefix = None          # Prefix waiting for its parameter
+        self.text = bytearray()     # Characters of the current text frame
+        self.text_at = 0.0
+        self.hold_until = None      # End of the hold of a slow command
+        self.bytes = 0
+        self.frames = 0
+        self.max_ahead = 0.0
+        self.min_hold = None
+        self.ahead_errors = 0
+        self.hold_errors = 0
+
+    def report(self, at, what):
+        self.frames += 1
+        if not self.args.quiet:
+            gap = (at - self.last) * 1000 if self.last is not None else 0.0
+            print('%10.3f ms  +%8.3f ms  %s' %
+                  ((at - self.start) * 1000, gap, what))
+        self.last = at
+
+    def flush_text(self):
+        if self.text:
+            self.report(self.text_at, 'text "%s" (%d)' % (
+                self.text.decode('latin-1'), len(self.text)))
+            self.text = bytearray()
+
+    def feed(self, value, at):
+        if self.start is None:
+            self.start = at
+        self.bytes += 1
+
+        # Line model: the byte goes out once the previous ones are sent. The
+        # bytes of a read share its time, one byte of tolerance.
+        ahead = max(self.line_free - at, 0.0) / self.byte_time
+        self.max_ahead = max(self.max_ahead, ahead)
+        if ahead > self.args.ahead + 1 + self.jitter / self.byte_time:
+            self.ahead_errors += 1
+        if self.hold_until is not None:
+            held = at - (self.hold_until - self.args.hold / 1e6)
+            self.min_hold = held if self.min_hold is None else min(
+                self.min_hold, held)
+            if at < self.hold_until - self.jitter:
+                self.hold_errors += 1
+                if not self.args.quiet:
+                    print('           hold violated: %.3f ms' % (held * 1000))
+            self.hold_until = None
+        self.line_free = max(self.line_free, at) + self.byte_time
+
+        if self.prefix is not None:
+            prefix, self.prefix = self.prefix, None
+            if prefix == SERLCD_COMMAND:
+                what, slow = instruction(value, self.args.cols,
+                                         self.args.rows)
+                if value == 0x01:
+                    self.display.clear()
+                elif value & 0x80:
+                    self.display.addr = value & 0x7F
+                elif slow:
+                    self.display.addr = 0
+            else:
+                what, slow = setting(value), True
+            if slow:
+                self.hold_until = self.line_free + self.args.hold / 1e6
+            self.report(at, what)
+        elif value in (SERLCD_COMMAND, SERLCD_SETTING):
+            self.flush_text()
+            self.prefix = value
+        else:
+            if not self.text:
+                self.text_at = at
+            self.text.append(value)
+            self.display.put(value)
+
+    def summary(self):
+        self.flush_text()
+        if self.start is None:
+            print('no data')
+            return 1
+        duration = self.line_free - self.start
+        print('')
+        print('%d bytes, %d frames in %.1f ms: %.0f bytes/s, line capacity '
+              '%.0f bytes/s' % (self.bytes, self.frames, duration * 1000,
+                                self.bytes / duration, 1 / self.byte_time))
+        print('bytes ahead of the line: max %.1f (limit %d), %d violations' %
+              (self.max_ahead, self.args.ahead, self.ahead_errors))
+        if self.min_hold is not None:
+            print('hold after slow commands: min %.3f ms (limit %.3f ms), '
+                  '%d violations' % (self.min_hold * 1000,
+                                     self.args.hold / 1000.0,
+                                     self.hold_errors))
+        for line in self.display.screen():
+            print(line)
+        return 1 if self.ahead_errors or self.hold_errors else 0
+
+
+def open_port(path, baud):
+    """Opens the serial port in raw mode, a pty pair if no path is given."""
+    if path is None:
+        master, slave = os.openpty()
+        tty.setraw(slave)
+        print('writing end: %s' % os.ttyname(slave), flush=True)
+        return master, slave
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+    if baud in BAUDS:
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = attrs[5] = BAUDS[baud]
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return fd, None
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decodes and times the output of LiquidCrystal_SerLCD.')
+    parser.add_argument('port', nargs='?', help='serial port, pty if none')
+    parser.add_argument('-b', '--baud', type=int, default=9600)
+    parser.add_argument('-c', '--cols', type=int, default=16)
+    parser.add_argument('-r', '--rows', type=int, default=2)
+    parser.add_argument('--ahead', type=int, default=16,
+                        help='LCD_SERLCD_AHEAD of the driver')
+    parser.add_argument('--hold', type=int, default=5000,
+                        help='LCD_SERLCD_SLOW_EXEC of the driver (us)')
+    parser.add_argument('--jitter', type=float, default=0.5,
+                        help='time stamp jitter of the capture (ms)')
+    parser.add_argument('--idle', type=float, default=None,
+                        help='stop after this many seconds without data')
+    parser.add_argument('-q', '--quiet', action='store_true')
+    args = parser.parse_args()
+
+    fd, keep = open_port(args.port, args.baud)
+
+    # Capture first, decoding while reading would delay the time stamps
+    chunks = []
+    try:
+        while True:
+            ready, _, _ = select.select([fd], [], [], args.idle)
+            if not ready:
+                break
+            try:
+                data = os.read(fd, 256)
+            except OSError:
+                break               # The writing end of the pty closed
+            chunks.append((time.monotonic(), data))
+    except KeyboardInterrupt:
+        pass
+
+    decoder = Decoder(args)
+    for at, data in chunks:
+        for value in data:
+            decoder.feed(value, at)
+    status = decoder.summary()
+    os.close(fd)
+    if keep is not None:
+        os.close(keep)
+    return status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,77 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file Arduino.h
+// Host (PC) stand-in of the Arduino core for the tests in extras/test.
+//
+// @brief
+// Only what the LCD classes under test use. There is no bus: the delays return at
+// once and the time is the time of the host. The pins written can be
+// watched by a test (hostPinHook).
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <chrono>
+
+#include "Print.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH     1
+#define LOW      0
+#define INPUT    0
+#define OUTPUT   1
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define PROGMEM
+#define pgm_read_byte(p)        ( *(const uint8_t *)( p ) )
+#define pgm_read_byte_near(p)   ( *(const uint8_t *)( p ) )
+
+inline unsigned long micros ( )
+{
+   return ( (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now ().time_since_epoch () ).count () );
+}
+
+inline unsigned long millis ( ) { return ( micros () / 1000 ); }
+inline void delay ( unsigned long ) { }
+inline void delayMicroseconds ( unsigned int ) { }
+
+/*!
+ @typedef
+ @abstract   Pin hook.
+ @discussion Lets a test watch the pins written, set with hostPinHook () =.
+ */
+typedef void (*t_hostPinHook)( uint8_t pin, uint8_t level );
+
+inline t_hostPinHook &hostPinHook ( )
+{
+   static t_hostPinHook hook = NULL;
+   return ( hook );
+}
+
+inline void pinMode ( uint8_t, uint8_t ) { }
+inline void digitalWrite ( uint8_t pin, uint8_t level )
+{
+   if ( hostPinHook () != NULL )
+   {
+      hostPinHook () ( pin, level );
+   }
+}
+inline int  digitalRead ( uint8_t ) { return ( LOW ); }
+inline void analogWrite ( uint8_t, int ) { }
+
+#endif
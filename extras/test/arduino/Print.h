@@ -0,0 +1,43 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file Print.h
+// Host (PC) stand-in of the Arduino Print class for the tests in extras/test.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+class Print
+{
+public:
+   virtual ~Print ( ) { };
+   virtual size_t write ( uint8_t value ) = 0;
+   virtual size_t write ( const uint8_t *buffer, size_t size )
+   {
+      size_t n = 0;
+
+      while ( size-- > 0 )
+      {
+         n += write ( *buffer++ );
+      }
+      return ( n );
+   };
+   size_t write ( const char *str )
+   {
+      return ( write ( (const uint8_t *)str, strlen ( str ) ) );
+   };
+   size_t print ( const char *str ) { return ( write ( str ) ); };
+};
+
+#endif
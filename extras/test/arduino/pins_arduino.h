@@ -0,0 +1,16 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file pins_arduino.h
+// Host (PC) stand-in of the pin definitions for the tests in extras/test.
+//
+// @brief
+// Empty: on the host FastIO falls back to digitalWrite.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
@@ -0,0 +1,392 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file lcdqueue_stress.cpp
+// Host (PC) stress test of LCDQueue with std::thread producers.
+//
+// @brief
+// Several producer threads post texts, clears and backlight changes to an
+// LCDQueue while a consumer thread services it on a stub LCD that checks
+// what it receives:
+//    - lossless run: the producers retry when the queue is full, every
+//      operation has to arrive once, complete and in the order of its
+//      producer, the texts of several slots never split by another one,
+//    - lossy run: the producers never retry and the consumer is slow, the
+//      operations executed plus the ones dropped have to be the ones posted.
+// Both runs are done with a small queue and with the largest one (128
+// slots). The positions of the queue wrap around many times in the lossless
+// run. The stub LCD has no bus, the throughput measured is the one of the
+// queue.
+//
+// Build and run, from the root of the library:
+//    g++ -std=gnu++11 -O2 -pthread -DARDUINO=100 -Iextras/test/arduino -I. extras/test/lcdqueue_stress.cpp LCDQueue.cpp LCD.cpp -o lcdqueue_stress && ./lcdqueue_stress
+//
+// Measured (x86-64 host, 1 CPU, g++ -O2): lossless run of 800000 texts
+// (1333336 slots), 4 producers and the consumer, at 0.8 to 1.1 million slots
+// per second with 64 slots.
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+#include "LCDQueue.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+#define PRODUCERS       4
+#define TEXTS           200000   // Texts per producer, lossless run
+#define LOSSY_TEXTS     5000     // Texts per producer, lossy run
+#define CLEAR_EVERY     5000     // Producer 0 posts a clear every ... texts
+#define BACKLIGHT_EVERY 1000     // Backlight change every ... texts
+#define LONG_TEXT       "abcdefghijklmnopqrstuvwxyz0123"
+#define MAX_SLOTS       128      // Largest queue
+
+/*!
+ @function
+ @abstract   Text posted by a producer.
+ @discussion One text in three is 41 characters, 3 slots of the queue.
+ */
+static std::string text ( int producer, long n )
+{
+   char buffer[64];
+
+   snprintf ( buffer, sizeof(buffer), "P%d-%07ld-%s", producer, n,
+              ( n % 3 == 0 ) ? LONG_TEXT : "x" );
+   return ( std::string ( buffer ) );
+}
+
+/*!
+ @class
+ @abstract    StubLCD
+ @discussion  LCD checking the operations executed by the queue, only
+ accessed by the consumer thread.
+ */
+class StubLCD : public LCD
+{
+public:
+   StubLCD ( bool strict )
+   {
+      _numlines = 1;
+      _cols     = 80;
+      _strict   = strict;
+      _texts    = 0;
+      _clears   = 0;
+      _errors   = 0;
+      _recordAt = 0;
+      for ( int p = 0; p < PRODUCERS; p++ )
+      {
+         _last[p]      = -1;
+         _backlight[p] = 0;
+      }
+   };
+
+   virtual void send ( uint8_t value, uint8_t mode )
+   {
+      if ( mode == LCD_DATA )
+      {
+         _record += (char)value;
+      }
+      else if ( value & LCD_SETDDRAMADDR )
+      {
+         endRecord ();
+         _recordAt = value & 0x7F;
+      }
+      else if ( value == LCD_CLEARDISPLAY )
+      {
+         endRecord ();
+         _clears++;
+      }
+   };
+
+   virtual void setBacklight ( uint8_t value )
+   {
+      int producer = value >> 6;
+
+      // The values of a producer are a sequence modulo 64
+      endRecord ();
+      if ( ( value & 0x3F ) != ( _backlight[producer] & 0x3F ) )
+      {
+         error ( "backlight out of order" );
+      }
+      _backlight[producer]++;
+   };
+
+   // Ends the checks, the last text has been received
+   void end ( ) { endRecord (); if ( !_pending.empty () ) error ( "cut" ); };
+
+   long texts ( ) { return ( _texts ); };
+   long clears ( ) { return ( _clears ); };
+   long backlight ( int producer ) { return ( _backlight[producer] ); };
+   long errors ( ) { return ( _errors ); };
+
+private:
+   void error ( const char *what )
+   {
+      if ( _errors++ < 10 )
+      {
+         printf ( "   error: %s\n", what );
+      }
+   };
+
+   // A text starts at column 0, its other slots follow at 20, 40, ...
+   void endRecord ( )
+   {
+      if ( _record.empty () )
+      {
+         return;
+      }
+      if ( _recordAt == 0 )
+      {
+         if ( !_pending.empty () )
+         {
+            error ( "text split by another operation" );
+         }
+         _pending = _record;
+      }
+      else if ( _recordAt == _pending.size () )
+      {
+         _pending += _record;
+      }
+      else
+      {
+         error ( "slot out of place" );
+      }
+      _record.clear ();
+      checkText ();
+   };
+
+   void checkText ( )
+   {
+      int  producer;
+      long n;
+
+      if ( ( sscanf ( _pending.c_str (), "P%d-%ld-", &producer, &n ) != 2 ) ||
+           ( producer < 0 ) || ( producer >= PRODUCERS ) )
+      {
+         error ( "garbled text" );
+         _pending.clear ();
+         return;
+      }
+
+      std::string expected = text ( producer, n );
+
+      if ( _pending.size () < expected.size () )
+      {
+         return;     // More slots to come
+      }
+      if ( _pending != expected )
+      {
+         error ( "corrupted text" );
+      }
+      if ( _strict ? ( n != _last[producer] + 1 ) : ( n <= _last[producer] ) )
+      {
+         error ( "text out of order" );
+      }
+      _last[producer] = n;
+      _texts++;
+      _pending.clear ();
+   };
+
+   bool        _strict;              // Every text has to arrive
+   std::string _record;              // Characters since the last position
+   uint8_t     _recordAt;            // Position of the record
+   std::string _pending;             // Text being received
+   long        _last[PRODUCERS];     // Last text of each producer
+   long        _backlight[PRODUCERS];// Backlight changes of each producer
+   long        _texts;
+   long        _clears;
+   long        _errors;
+};
+
+/*!
+ @function
+ @abstract   Lossless run.
+ @param      numSlots[in] size of the queue.
+ @result     number of errors.
+ */
+static long lossless ( uint8_t numSlots )
+{
+   static t_lcdQueueSlot slots[MAX_SLOTS];
+   StubLCD   lcd ( true );
+   LCDQueue  queue ( lcd, slots, numSlots );
+   std::atomic<int>  running ( PRODUCERS );
+   std::atomic<long> refused ( 0 );
+   std::vector<std::thread> producers;
+   long      clears = 0;
+   long      errors;
+   unsigned long slotsPosted = 0;
+
+   auto start = std::chrono::steady_clock::now ();
+
+   for ( int p = 0; p < PRODUCERS; p++ )
+   {
+      producers.emplace_back ( [&queue, &running, &refused, p] ( )
+      {
+         for ( long n = 0; n < TEXTS; n++ )
+         {
+            std::string t = text ( p, n );
+
+            // Every refusal is counted by the queue as a drop
+            while ( !queue.printAt ( 0, 0, t.c_str () ) )
+            {
+               refused++;
+               std::this_thread::yield ();
+            }
+            if ( ( p == 0 ) && ( n % CLEAR_EVERY == 0 ) )
+            {
+               while ( !queue.clear () )
+               {
+                  refused++;
+                  std::this_thread::yield ();
+               }
+            }
+            if ( n % BACKLIGHT_EVERY == 0 )
+            {
+               uint8_t value = ( p << 6 ) | ( ( n / BACKLIGHT_EVERY ) & 0x3F );
+
+               while ( !queue.setBacklight ( value ) )
+               {
+                  refused++;
+                  std::this_thread::yield ();
+               }
+            }
+         }
+         running--;
+      } );
+   }
+
+   std::thread consumer ( [&queue, &running] ( )
+   {
+      while ( running.load () > 0 )
+      {
+         if ( queue.service () == 0 )
+         {
+            std::this_thread::yield ();
+         }
+      }
+      while ( queue.service () > 0 );
+   } );
+
+   for ( auto &t : producers )
+   {
+      t.join ();
+   }
+   consumer.join ();
+   lcd.end ();
+
+   double seconds = std::chrono::duration<double> (
+                       std::chrono::steady_clock::now () - start ).count ();
+
+   for ( long n = 0; n < TEXTS; n++ )
+   {
+      slotsPosted += ( n % 3 == 0 ) ? 3 : 1;
+      clears      += ( n % CLEAR_EVERY == 0 ) ? 1 : 0;
+   }
+   slotsPosted *= PRODUCERS;
+
+   errors = lcd.errors ();
+   if ( ( lcd.texts () != (long)PRODUCERS * TEXTS ) || ( lcd.clears () != clears ) ||
+        ( queue.dropped () != ( ( refused.load () < 0xFFFF ) ? refused.load () : 0xFFFF ) ) )
+   {
+      printf ( "   error: texts %ld clears %ld refused %ld dropped %u\n",
+               lcd.texts (), lcd.clears (), refused.load (), queue.dropped () );
+      errors++;
+   }
+   for ( int p = 0; p < PRODUCERS; p++ )
+   {
+      if ( lcd.backlight ( p ) != ( TEXTS + BACKLIGHT_EVERY - 1 ) / BACKLIGHT_EVERY )
+      {
+         printf ( "   error: producer %d backlight %ld\n", p, lcd.backlight ( p ) );
+         errors++;
+      }
+   }
+
+   printf ( "lossless, %3d slots: %ld texts, %lu slots, %d threads in %.2fs: "
+            "%.0f slots/s\n", numSlots, lcd.texts (), slotsPosted,
+            PRODUCERS + 1, seconds, slotsPosted / seconds );
+   return ( errors );
+}
+
+/*!
+ @function
+ @abstract   Lossy run.
+ @param      numSlots[in] size of the queue.
+ @result     number of errors.
+ */
+static long lossy ( uint8_t numSlots )
+{
+   static t_lcdQueueSlot slots[MAX_SLOTS];
+   StubLCD   lcd ( false );
+   LCDQueue  queue ( lcd, slots, numSlots );
+   std::atomic<int>  running ( PRODUCERS );
+   std::atomic<long> refused ( 0 );
+   std::vector<std::thread> producers;
+   long      errors;
+
+   for ( int p = 0; p < PRODUCERS; p++ )
+   {
+      producers.emplace_back ( [&queue, &running, &refused, p] ( )
+      {
+         for ( long n = 0; n < LOSSY_TEXTS; n++ )
+         {
+            if ( !queue.printAt ( 0, 0, text ( p, n ).c_str () ) )
+            {
+               refused++;
+            }
+            std::this_thread::yield ();
+         }
+         running--;
+      } );
+   }
+
+   std::thread consumer ( [&queue, &running] ( )
+   {
+      while ( running.load () > 0 )
+      {
+         queue.service ( 1 );
+         std::this_thread::sleep_for ( std::chrono::microseconds ( 20 ) );
+      }
+      while ( queue.service () > 0 );
+   } );
+
+   for ( auto &t : producers )
+   {
+      t.join ();
+   }
+   consumer.join ();
+   lcd.end ();
+
+   errors = lcd.errors ();
+   if ( ( lcd.texts () + refused.load () != (long)PRODUCERS * LOSSY_TEXTS ) ||
+        ( queue.dropped () != refused.load () ) )
+   {
+      printf ( "   error: texts %ld refused %ld dropped %u\n", lcd.texts (),
+               refused.load (), queue.dropped () );
+      errors++;
+   }
+
+   printf ( "lossy, %3d slots: %ld texts executed, %ld dropped\n", numSlots,
+            lcd.texts (), refused.load () );
+   return ( errors );
+}
+
+int main ( )
+{
+   long errors = lossless ( 64 );
+
+   errors += lossless ( MAX_SLOTS );
+   errors += lossy ( 16 );
+   errors += lossy ( MAX_SLOTS );
+   printf ( "%s\n", ( errors == 0 ) ? "PASS" : "FAIL" );
+   return ( ( errors == 0 ) ? 0 : 1 );
+}
@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------------
+// Created by Francisco Malpartida on 18/10/26.
+// Copyright 2026 - Under creative commons license 3.0:
+//        Attribution-ShareAlike CC BY-SA
+//
+// This software is furnished "as is", without technical support, and with no
+// warranty, express or implied, as to its usefulness for any purpose.
+//
+// @file sharedbus_print.cpp
+// Host (PC) test of LiquidCrystal_SharedBus::printAll.
+//
+// @brief
+// Three LCDs share RS and D4-D7 and have their own enable line, as in
+// examples/SharedBus. The pins written are watched: the data nibbles latched
+// by each enable line (falling edge, RS high) are put back together and
+// compared with the strings given to printAll, including empty and NULL
+// strings and strings of different lengths.
+//
+// Build and run, from the root of the library:
+//    g++ -std=gnu++11 -O2 -DARDUINO=100 -Iextras/test/arduino -I. extras/test/sharedbus_print.cpp LiquidCrystal_SharedBus.cpp LiquidCrystal.cpp LCD.cpp FastIO.cpp -o sharedbus_print && ./sharedbus_print
+//
+// @author F. Malpartida - fmalpartida@gmail.com
+// ---------------------------------------------------------------------------
+#include <stdio.h>
+#include <string>
+
+#include "LiquidCrystal_SharedBus.h"
+
+// CONSTANT  definitions
+// ---------------------------------------------------------------------------
+#define RS      12
+#define D4      5
+#define D5      4
+#define D6      3
+#define D7      2
+#define LCDS    3
+
+static const uint8_t enablePin[LCDS] = { 11, 10, 9 };
+
+static uint8_t     level[256];       // Level of each pin
+static uint8_t     nibbles[LCDS];    // Data nibbles latched by each LCD
+static uint8_t     high[LCDS];       // High nibble of the character
+static std::string received[LCDS];   // Characters latched by each LCD
+
+/*!
+ @function
+ @abstract   Pin hook, decodes the data written to each LCD.
+ */
+static void watch ( uint8_t pin, uint8_t value )
+{
+   for ( uint8_t i = 0; i < LCDS; i++ )
+   {
+      // The LCD latches the data lines on the falling edge of its enable
+      if ( ( pin == enablePin[i] ) && level[pin] && !value && level[RS] )
+      {
+         uint8_t nibble = ( level[D4] ? 0x1 : 0 ) | ( level[D5] ? 0x2 : 0 ) |
+                          ( level[D6] ? 0x4 : 0 ) | ( level[D7] ? 0x8 : 0 );
+
+         if ( ( nibbles[i]++ & 0x1 ) == 0 )
+         {
+            high[i] = nibble;
+         }
+         else
+         {
+            received[i] += (char)( ( high[i] << 4 ) | nibble );
+         }
+      }
+   }
+   level[pin] = value;
+}
+
+/*!
+ @function
+ @abstract   Prints on all the LCDs and checks what each one received.
+ @result     number of errors.
+ */
+static int check ( LiquidCrystal_SharedBus *lcd[], const char *str[] )
+{
+   int errors = 0;
+
+   for ( uint8_t i = 0; i < LCDS; i++ )
+   {
+      received[i].clear ();
+      nibbles[i] = 0;
+   }
+
+   LiquidCrystal_SharedBus::printAll ( lcd, LCDS, str );
+
+   for ( uint8_t i = 0; i < LCDS; i++ )
+   {
+      std::string expected = ( str[i] != NULL ) ? str[i] : "";
+
+      printf ( "   enable %2d: %2zu characters \"%s\"\n", enablePin[i],
+               received[i].size (), received[i].c_str () );
+      if ( ( received[i] != expected ) || ( nibbles[i] & 0x1 ) )
+      {
+         printf ( "   error: expected \"%s\"\n", expected.c_str () );
+         errors++;
+      }
+   }
+   return ( errors );
+}
+
+int main ( )
+{
+   //                          RS  EN  D4  D5  D6  D7
+   LiquidCrystal_SharedBus lcd1 ( RS, 11, D4, D5, D6, D7 );
+   LiquidCrystal_SharedBus lcd2 ( RS, 10, D4, D5, D6, D7 );
+   LiquidCrystal_SharedBus lcd3 ( RS,  9, D4, D5, D6, D7 );
+   LiquidCrystal_SharedBus *panel[LCDS] = { &lcd1, &lcd2, &lcd3 };
+   LCD *display[LCDS] = { &lcd1, &lcd2, &lcd3 };
+   const char *title[LCDS] = { "Rack 1", "Rack 2", "Rack 3" };
+   const char *mixed[LCDS] = { "a longer line 16", NULL, "" };
+   const char *other[LCDS] = { "", "x", "short" };
+   int errors = 0;
+
+   LCD::beginAll ( display, LCDS, 16, 2 );
+   hostPinHook () = watch;
+
+   errors += check ( panel, title );
+   errors += check ( panel, mixed );
+   errors += check ( panel, other );
+
+   printf ( "%s\n", ( errors == 0 ) ? "PASS" : "FAIL" );
+   return ( ( errors == 0 ) ? 0 : 1 );
+}